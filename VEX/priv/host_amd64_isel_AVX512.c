@@ -309,6 +309,202 @@ static void load_HReg_from_register(ISelEnv* env, const IRExpr* ir, HReg* dst, H
    }
 }
 
+/* Generate a V128 constant with the given halves.  Going through integer
+   registers rather than the stack avoids a store forwarding stall. */
+static HReg generate_V128_const ( ISelEnv* env, ULong hi, ULong lo )
+{
+   HReg dst = newVRegV(env);
+   HReg r   = newVRegI(env);
+   addInstr(env, AMD64Instr_Imm64(lo, r));
+   addInstr(env, AMD64Instr_SseMOVQ(r, dst, True/*toXMM*/));
+   if (hi == lo) {
+      addInstr(env, AMD64Instr_SseReRg(Asse_UNPCKLQ, dst, dst));
+   } else {
+      HReg tmp = newVRegV(env);
+      r = newVRegI(env);
+      addInstr(env, AMD64Instr_Imm64(hi, r));
+      addInstr(env, AMD64Instr_SseMOVQ(r, tmp, True/*toXMM*/));
+      addInstr(env, AMD64Instr_SseReRg(Asse_UNPCKLQ, tmp, dst));
+   }
+   return dst;
+}
+
+/* Iop_ExpandBitsToV128/V256/V512 with a constant element width, for the
+   n_quarters 128-bit quarters of the result: element i is all ones if
+   bit i of the mask is set, and zero otherwise.  Every masked AVX-512
+   instruction does this, so do it inline rather than with a helper call:
+   get the mask bits for the elements of a quarter into all of them, AND
+   each element with the bit it stands for, and compare the result with
+   that bit.  Returns False if the width is not a constant. */
+static Bool expand_bits_to_vec ( HReg* dst, ISelEnv* env, const IRExpr* e,
+                                 Int n_quarters )
+{
+   const IRExpr* width = e->Iex.Binop.arg2;
+   if (width->tag != Iex_Const || width->Iex.Const.con->tag != Ico_U8)
+      return False;
+
+   /* The width is an enum dstWidth, see host_generic_AVX512_F.c. */
+   UInt w    = width->Iex.Const.con->Ico.U8;
+   HReg mask = iselIntExpr_R(env, e->Iex.Binop.arg1);
+   HReg bits, m;
+   switch (w) {
+      case 0: /* 8 bits: 16 elements per quarter */
+      case 1: /* 16 bits: 8 elements per quarter */
+         if (w == 0)
+            bits = generate_V128_const(env, 0x8040201008040201ULL,
+                                            0x8040201008040201ULL);
+         else
+            bits = generate_V128_const(env, 0x0080004000200010ULL,
+                                            0x0008000400020001ULL);
+         for (Int i = 0; i < n_quarters; i++) {
+            m = mask;
+            if (i > 0) {
+               m = newVRegI(env);
+               addInstr(env, mk_iMOVsd_RR(mask, m));
+               addInstr(env, AMD64Instr_Sh64(Ash_SHR, (w == 0 ? 16 : 8) * i,
+                                             m));
+            }
+            dst[i] = newVRegV(env);
+            addInstr(env, AMD64Instr_SseMOVQ(m, dst[i], True/*toXMM*/));
+            if (w == 0) {
+               /* Bytes 0..7 get mask byte 0, bytes 8..15 mask byte 1. */
+               addInstr(env, AMD64Instr_SseReRg(Asse_UNPCKLB, dst[i], dst[i]));
+               addInstr(env, AMD64Instr_SseReRg(Asse_UNPCKLW, dst[i], dst[i]));
+               addInstr(env, AMD64Instr_SseReRg(Asse_UNPCKLD, dst[i], dst[i]));
+            } else {
+               addInstr(env, AMD64Instr_SseReRg(Asse_UNPCKLW, dst[i], dst[i]));
+               addInstr(env, AMD64Instr_SseShuf(0x00, dst[i], dst[i]));
+            }
+            addInstr(env, AMD64Instr_SseReRg(Asse_AND, bits, dst[i]));
+            addInstr(env, AMD64Instr_SseReRg(w == 0 ? Asse_CMPEQ8
+                                                    : Asse_CMPEQ16,
+                                             bits, dst[i]));
+         }
+         return True;
+      case 2: /* 32 bits: 4 elements per quarter */
+      case 3: /* 64 bits: 2 elements per quarter */
+         /* At most 16 mask bits are used, so the low 32 bits of the mask
+            are put in all 32-bit lanes, and shifted right for each
+            quarter.  A 64-bit element is compared as two 32-bit lanes,
+            the upper one of which is zero on both sides, and the result
+            of the lower one is then copied to it. */
+         if (w == 3)
+            bits = generate_V128_const(env, 2, 1);
+         else
+            bits = generate_V128_const(env, 0x0000000800000004ULL,
+                                            0x0000000200000001ULL);
+         m = newVRegV(env);
+         addInstr(env, AMD64Instr_SseMOVQ(mask, m, True/*toXMM*/));
+         addInstr(env, AMD64Instr_SseShuf(0x00, m, m));
+         for (Int i = 0; i < n_quarters; i++) {
+            HReg tmp = newVRegV(env);
+            addInstr(env, mk_vMOVsd_RR(m, tmp));
+            if (i > 0)
+               addInstr(env, AMD64Instr_SseShiftN(Asse_SHR32,
+                                                  (w == 3 ? 2 : 4) * i, tmp));
+            addInstr(env, AMD64Instr_SseReRg(Asse_AND, bits, tmp));
+            addInstr(env, AMD64Instr_SseReRg(Asse_CMPEQ32, bits, tmp));
+            if (w == 3) {
+               dst[i] = newVRegV(env);
+               addInstr(env, AMD64Instr_SseShuf(0xA0, tmp, dst[i]));
+            } else {
+               dst[i] = tmp;
+            }
+         }
+         return True;
+      default:
+         return False;
+   }
+}
+
+/* Compute the bitwise function of b and c whose truth table is t, bit
+   (b<<1)|c of t being the result for those values of b and c. */
+static HReg ternlog2_V128 ( ISelEnv* env, UInt t, HReg b, HReg c )
+{
+   HReg dst;
+   switch (t) {
+      case 0x0: return generate_zeroes_V128(env);
+      case 0xF: return generate_ones_V128(env);
+      case 0xC: return b;
+      case 0xA: return c;
+      case 0x3: return do_sse_NotV128(env, b);
+      case 0x5: return do_sse_NotV128(env, c);
+      case 0x8: case 0x7:
+         dst = newVRegV(env);
+         addInstr(env, mk_vMOVsd_RR(b, dst));
+         addInstr(env, AMD64Instr_SseReRg(Asse_AND, c, dst));
+         return t == 0x8 ? dst : do_sse_NotV128(env, dst);
+      case 0xE: case 0x1:
+         dst = newVRegV(env);
+         addInstr(env, mk_vMOVsd_RR(b, dst));
+         addInstr(env, AMD64Instr_SseReRg(Asse_OR, c, dst));
+         return t == 0xE ? dst : do_sse_NotV128(env, dst);
+      case 0x6: case 0x9:
+         dst = newVRegV(env);
+         addInstr(env, mk_vMOVsd_RR(b, dst));
+         addInstr(env, AMD64Instr_SseReRg(Asse_XOR, c, dst));
+         return t == 0x6 ? dst : do_sse_NotV128(env, dst);
+      case 0x2: case 0xD: /* ~b & c, and its complement */
+         dst = newVRegV(env);
+         addInstr(env, mk_vMOVsd_RR(b, dst));
+         addInstr(env, AMD64Instr_SseReRg(Asse_ANDN, c, dst));
+         return t == 0x2 ? dst : do_sse_NotV128(env, dst);
+      case 0x4: case 0xB: /* b & ~c, and its complement */
+         dst = newVRegV(env);
+         addInstr(env, mk_vMOVsd_RR(c, dst));
+         addInstr(env, AMD64Instr_SseReRg(Asse_ANDN, b, dst));
+         return t == 0x4 ? dst : do_sse_NotV128(env, dst);
+      default:
+         vassert(0);
+   }
+}
+
+/* Iop_Ternlog32x16/64x8 with a constant immediate.  These are bitwise,
+   so the element size does not matter.  Bit (a<<2)|(b<<1)|c of the
+   immediate is the result for those values of a (the destination), b
+   and c, hence the result is (a & f1(b,c)) | (~a & f0(b,c)), where f1
+   and f0 are the upper and lower half of the immediate.  Returns False
+   if the immediate is not a constant. */
+static Bool ternlog_V512 ( HReg* dst, ISelEnv* env, const IRExpr* e )
+{
+   const IRQop* qop = e->Iex.Qop.details;
+   if (qop->arg4->tag != Iex_Const || qop->arg4->Iex.Const.con->tag != Ico_U8)
+      return False;
+
+   UInt imm = qop->arg4->Iex.Const.con->Ico.U8;
+   UInt f1  = imm >> 4;
+   UInt f0  = imm & 0xF;
+   HReg a[MULT512], b[MULT512], c[MULT512];
+   iselExpr_512(a, env, qop->arg1);
+   iselExpr_512(b, env, qop->arg2);
+   iselExpr_512(c, env, qop->arg3);
+   for (Int i = 0; i < MULT512; i++) {
+      HReg g0 = ternlog2_V128(env, f0, b[i], c[i]);
+      if (f1 == f0) {
+         dst[i] = g0;
+         continue;
+      }
+      HReg g1 = ternlog2_V128(env, f1, b[i], c[i]);
+      dst[i] = newVRegV(env);
+      if (f0 == 0) {
+         /* a & g1 */
+         addInstr(env, mk_vMOVsd_RR(a[i], dst[i]));
+         addInstr(env, AMD64Instr_SseReRg(Asse_AND, g1, dst[i]));
+      } else if (f1 == 0) {
+         /* ~a & g0 */
+         addInstr(env, mk_vMOVsd_RR(a[i], dst[i]));
+         addInstr(env, AMD64Instr_SseReRg(Asse_ANDN, g0, dst[i]));
+      } else {
+         /* g0 ^ (a & (g0 ^ g1)) */
+         addInstr(env, mk_vMOVsd_RR(g0, dst[i]));
+         addInstr(env, AMD64Instr_SseReRg(Asse_XOR, g1, dst[i]));
+         addInstr(env, AMD64Instr_SseReRg(Asse_AND, a[i], dst[i]));
+         addInstr(env, AMD64Instr_SseReRg(Asse_XOR, g0, dst[i]));
+      }
+   }
+   return True;
+}
+
 static void handle_unop(HReg *dst, ISelEnv* env, const IRExpr* e)
 {
    HWord fn = 0;
@@ -438,6 +634,18 @@ static void handle_binop(HReg *dst, ISelEnv* env, const IRExpr* e) {
          }
          return;
       }
+      case Iop_ExpandBitsToV128:
+         if (expand_bits_to_vec(dst, env, e, 1))
+            return;
+         break;
+      case Iop_ExpandBitsToV256:
+         if (expand_bits_to_vec(dst, env, e, 2))
+            return;
+         break;
+      case Iop_ExpandBitsToV512:
+         if (expand_bits_to_vec(dst, env, e, MULT512))
+            return;
+         break;
       case Iop_ShrV128:  fn = (HWord) h_Iop_ShrV128;  break;
       case Iop_ShlV128:  fn = (HWord) h_Iop_ShlV128;  break;
       default: break;
@@ -519,6 +727,16 @@ static void handle_triop(HReg *dst, ISelEnv* env, const IRExpr* e) {
 }
 
 static void handle_qop(HReg *dst, ISelEnv* env, const IRExpr* e) {
+   // Special cases:
+   switch (e->Iex.Qop.details->op) {
+      case Iop_Ternlog32x16:
+      case Iop_Ternlog64x8:
+         if (ternlog_V512(dst, env, e))
+            return;
+         break;
+      default: break;
+   }
+
    UInt ir_op = e->Iex.Qop.details->op - Iop_LAST_NOT_EVEX;
    vassert(ir_op <= (Iop_LAST - Iop_LAST_NOT_EVEX));
    
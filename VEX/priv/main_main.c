@@ -202,6 +202,19 @@ void LibVEX_default_VexControl ( /*OUT*/ VexControl* vcon )
 
 /* Exported to library client. */
 
+static void check_VexControl ( const VexControl* vcon )
+{
+   vassert(vcon->iropt_verbosity >= 0);
+   vassert(vcon->iropt_level >= 0);
+   vassert(vcon->iropt_level <= 2);
+   vassert(vcon->iropt_unroll_thresh >= 0);
+   vassert(vcon->iropt_unroll_thresh <= 400);
+   vassert(vcon->guest_max_insns >= 1);
+   vassert(vcon->guest_max_insns <= 100);
+   vassert(vcon->guest_chase == False || vcon->guest_chase == True);
+   vassert(vcon->regalloc_version == 2 || vcon->regalloc_version == 3);
+}
+
 void LibVEX_Init (
    /* failure exit function */
    __attribute__ ((noreturn))
@@ -225,15 +238,7 @@ void LibVEX_Init (
    vassert(log_bytes);
    vassert(debuglevel >= 0);
 
-   vassert(vcon->iropt_verbosity >= 0);
-   vassert(vcon->iropt_level >= 0);
-   vassert(vcon->iropt_level <= 2);
-   vassert(vcon->iropt_unroll_thresh >= 0);
-   vassert(vcon->iropt_unroll_thresh <= 400);
-   vassert(vcon->guest_max_insns >= 1);
-   vassert(vcon->guest_max_insns <= 100);
-   vassert(vcon->guest_chase == False || vcon->guest_chase == True);
-   vassert(vcon->regalloc_version == 2 || vcon->regalloc_version == 3);
+   check_VexControl(vcon);
 
    /* Check that Vex has been built with sizes of basic types as
       stated in priv/libvex_basictypes.h.  Failure of any of these is
@@ -303,6 +308,15 @@ void LibVEX_Init (
 }
 
 
+/* Change the optimiser controls for subsequent translations. */
+void LibVEX_Update_Control ( const VexControl* vcon )
+{
+   vassert(vex_initdone);
+   check_VexControl(vcon);
+   vex_control = *vcon;
+}
+
+
 /* --------- Make a translation. --------- */
 
 /* KLUDGE: S390 need to know the hwcaps of the host when generating
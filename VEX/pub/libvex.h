@@ -671,6 +671,11 @@ extern void LibVEX_Init (
    const VexControl* vcon
 );
 
+/* Replace the VexControl given to LibVEX_Init.  This affects all
+   translations made after the call. */
+
+extern void LibVEX_Update_Control ( const VexControl* vcon );
+
 
 /*-------------------------------------------------------*/
 /*--- Make a translation                              ---*/
@@ -121,6 +121,8 @@ static void parse_cache_opt ( cache_t* cache, const HChar* opt,
 }
 
 
+cache_repl_t VG_(clo_cache_replacement) = Repl_LRU;
+
 Bool VG_(str_clo_cache_opt)(const HChar *arg,
                             cache_t* clo_I1c,
                             cache_t* clo_D1c,
@@ -138,6 +140,13 @@ Bool VG_(str_clo_cache_opt)(const HChar *arg,
               VG_STR_CLO(arg, "--LL", tmp_str)) {
       parse_cache_opt(clo_LLc, arg, tmp_str);
       return True;
+   } else if (VG_XACT_CLO(arg, "--cache-replacement=lru",
+                          VG_(clo_cache_replacement), Repl_LRU) ||
+              VG_XACT_CLO(arg, "--cache-replacement=plru",
+                          VG_(clo_cache_replacement), Repl_PLRU) ||
+              VG_XACT_CLO(arg, "--cache-replacement=random",
+                          VG_(clo_cache_replacement), Repl_Random)) {
+      return True;
    } else
       return False;
 }
@@ -326,6 +335,8 @@ void VG_(print_cache_clo_opts)(void)
 "    --I1=<size>,<assoc>,<line_size>  set I1 cache manually\n"
 "    --D1=<size>,<assoc>,<line_size>  set D1 cache manually\n"
 "    --LL=<size>,<assoc>,<line_size>  set LL cache manually\n"
+"    --cache-replacement=lru|plru|random  replacement policy of the\n"
+"                                     simulated caches [lru]\n"
    );
 }
 
@@ -38,12 +38,19 @@ typedef struct {
 
 #define MIN_LINE_SIZE         16
 
+// Replacement policy of the simulated caches, see cg_setsim.c.
+typedef enum { Repl_LRU, Repl_PLRU, Repl_Random } cache_repl_t;
+
+// Set by --cache-replacement, parsed by VG_(str_clo_cache_opt).
+extern cache_repl_t VG_(clo_cache_replacement);
+
 // clo_*c used in the call to VG_(str_clo_cache_opt) should be statically
 // initialized to UNDEFINED_CACHE.
 #define UNDEFINED_CACHE     { -1, -1, -1 }
 
 // If arg is a command line option configuring I1 or D1 or LL cache,
-// then parses arg to set the relevant cache_t elements.
+// then parses arg to set the relevant cache_t elements (or, for
+// --cache-replacement, VG_(clo_cache_replacement)).
 // Returns True if arg is a cache command line option, False otherwise.
 Bool VG_(str_clo_cache_opt)(const HChar *arg,
                             cache_t* clo_I1c,
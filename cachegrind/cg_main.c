@@ -45,6 +45,7 @@
 
 #include "cachegrind.h"
 #include "cg_arch.h"
+#include "cg_setsim.c"
 #include "cg_sim.c"
 #include "cg_branchpred.c"
 
@@ -148,10 +149,43 @@ struct _InstrInfo {
    LineCC* parent;         // parent line-CC
 };
 
+// With --cache-sim=yes, the cache accesses made between two flushes of
+// the event list (see flushEvents) are simulated together by a single call
+// of log_cache_events, which is passed a SimGroup describing them.  The
+// SimGroups of an SB are freed along with its SB_info.
+//
+// An instruction read within the line read by the previous instruction of
+// its group is known to hit the MRU way of I1, which leaves the cache
+// unchanged, so it is not simulated: only its count is incremented, with
+// those of the group's other such reads on the same line-CC.
+typedef struct {
+   Addr     addr;  // instruction address; unused for data accesses
+   CacheCC* cc;    // counts to update
+   UShort   pos;   // position of the access in the group
+   UChar    size;  // instruction length, or data size
+   Bool     NoX;   // instruction read not crossing cache lines
+} SimEvent;
+
+typedef struct _SimGroup SimGroup;
+typedef struct {
+   CacheCC* cc;
+   UInt     n;             // number of known I1 hits counted in cc
+} SimHits;
+
+struct _SimGroup {
+   SimGroup* next;
+   SimHits*  hits;         // n_hits entries, after the events
+   Int       n_hits;
+   Int       n_Ir;         // instruction reads, in order
+   Int       n_D;          // followed by the data accesses, in order
+   SimEvent  events[0];
+};
+
 typedef struct _SB_info SB_info;
 struct _SB_info {
    Addr      SB_addr;      // key;  MUST BE FIRST
    Int       n_instrs;
+   SimGroup* groups;       // with --cache-sim=yes, see SimGroup
    InstrInfo instrs[0];
 };
 
@@ -331,93 +365,6 @@ void log_3Ir(InstrInfo* n, InstrInfo* n2, InstrInfo* n3)
    n3->parent->Ir.a++;
 }
 
-// Generic case for instruction reads: may cross cache lines.
-// All other Ir handlers expect IrNoX instruction reads.
-static VG_REGPARM(1)
-void log_1IrGen_0D_cache_access(InstrInfo* n)
-{
-   //VG_(printf)("1IrGen_0D :  CCaddr=0x%010lx,  iaddr=0x%010lx,  isize=%lu\n",
-   //             n, n->instr_addr, n->instr_len);
-   cachesim_I1_doref_Gen(n->instr_addr, n->instr_len,
-			 &n->parent->Ir.m1, &n->parent->Ir.mL);
-   n->parent->Ir.a++;
-}
-
-static VG_REGPARM(1)
-void log_1IrNoX_0D_cache_access(InstrInfo* n)
-{
-   //VG_(printf)("1IrNoX_0D :  CCaddr=0x%010lx,  iaddr=0x%010lx,  isize=%lu\n",
-   //             n, n->instr_addr, n->instr_len);
-   cachesim_I1_doref_NoX(n->instr_addr, n->instr_len,
-			 &n->parent->Ir.m1, &n->parent->Ir.mL);
-   n->parent->Ir.a++;
-}
-
-static VG_REGPARM(2)
-void log_2IrNoX_0D_cache_access(InstrInfo* n, InstrInfo* n2)
-{
-   //VG_(printf)("2IrNoX_0D : CC1addr=0x%010lx, i1addr=0x%010lx, i1size=%lu\n"
-   //            "            CC2addr=0x%010lx, i2addr=0x%010lx, i2size=%lu\n",
-   //            n,  n->instr_addr,  n->instr_len,
-   //            n2, n2->instr_addr, n2->instr_len);
-   cachesim_I1_doref_NoX(n->instr_addr, n->instr_len,
-			 &n->parent->Ir.m1, &n->parent->Ir.mL);
-   n->parent->Ir.a++;
-   cachesim_I1_doref_NoX(n2->instr_addr, n2->instr_len,
-			 &n2->parent->Ir.m1, &n2->parent->Ir.mL);
-   n2->parent->Ir.a++;
-}
-
-static VG_REGPARM(3)
-void log_3IrNoX_0D_cache_access(InstrInfo* n, InstrInfo* n2, InstrInfo* n3)
-{
-   //VG_(printf)("3IrNoX_0D : CC1addr=0x%010lx, i1addr=0x%010lx, i1size=%lu\n"
-   //            "            CC2addr=0x%010lx, i2addr=0x%010lx, i2size=%lu\n"
-   //            "            CC3addr=0x%010lx, i3addr=0x%010lx, i3size=%lu\n",
-   //            n,  n->instr_addr,  n->instr_len,
-   //            n2, n2->instr_addr, n2->instr_len,
-   //            n3, n3->instr_addr, n3->instr_len);
-   cachesim_I1_doref_NoX(n->instr_addr, n->instr_len,
-			 &n->parent->Ir.m1, &n->parent->Ir.mL);
-   n->parent->Ir.a++;
-   cachesim_I1_doref_NoX(n2->instr_addr, n2->instr_len,
-			 &n2->parent->Ir.m1, &n2->parent->Ir.mL);
-   n2->parent->Ir.a++;
-   cachesim_I1_doref_NoX(n3->instr_addr, n3->instr_len,
-			 &n3->parent->Ir.m1, &n3->parent->Ir.mL);
-   n3->parent->Ir.a++;
-}
-
-static VG_REGPARM(3)
-void log_1IrNoX_1Dr_cache_access(InstrInfo* n, Addr data_addr, Word data_size)
-{
-   //VG_(printf)("1IrNoX_1Dr:  CCaddr=0x%010lx,  iaddr=0x%010lx,  isize=%lu\n"
-   //            "                               daddr=0x%010lx,  dsize=%lu\n",
-   //            n, n->instr_addr, n->instr_len, data_addr, data_size);
-   cachesim_I1_doref_NoX(n->instr_addr, n->instr_len,
-			 &n->parent->Ir.m1, &n->parent->Ir.mL);
-   n->parent->Ir.a++;
-
-   cachesim_D1_doref(data_addr, data_size, 
-                     &n->parent->Dr.m1, &n->parent->Dr.mL);
-   n->parent->Dr.a++;
-}
-
-static VG_REGPARM(3)
-void log_1IrNoX_1Dw_cache_access(InstrInfo* n, Addr data_addr, Word data_size)
-{
-   //VG_(printf)("1IrNoX_1Dw:  CCaddr=0x%010lx,  iaddr=0x%010lx,  isize=%lu\n"
-   //            "                               daddr=0x%010lx,  dsize=%lu\n",
-   //            n, n->instr_addr, n->instr_len, data_addr, data_size);
-   cachesim_I1_doref_NoX(n->instr_addr, n->instr_len,
-			 &n->parent->Ir.m1, &n->parent->Ir.mL);
-   n->parent->Ir.a++;
-
-   cachesim_D1_doref(data_addr, data_size, 
-                     &n->parent->Dw.m1, &n->parent->Dw.mL);
-   n->parent->Dw.a++;
-}
-
 /* Note that addEvent_D_guarded assumes that log_0Ir_1Dr_cache_access
    and log_0Ir_1Dw_cache_access have exactly the same prototype.  If
    you change them, you must change addEvent_D_guarded too. */
@@ -505,6 +452,14 @@ typedef
    IRExpr 
    IRAtom;
 
+#if defined(VG_BIGENDIAN)
+# define CGEndness Iend_BE
+#elif defined(VG_LITTLEENDIAN)
+# define CGEndness Iend_LE
+#else
+# error "Unknown endianness"
+#endif
+
 typedef 
    enum { 
       Ev_IrNoX,  // Instruction read not crossing cache lines
@@ -552,15 +507,6 @@ static void init_Event ( Event* ev ) {
    VG_(memset)(ev, 0, sizeof(Event));
 }
 
-static IRAtom* get_Event_dea ( Event* ev ) {
-   switch (ev->tag) {
-      case Ev_Dr: return ev->Ev.Dr.ea;
-      case Ev_Dw: return ev->Ev.Dw.ea;
-      case Ev_Dm: return ev->Ev.Dm.ea;
-      default:    tl_assert(0);
-   }
-}
-
 static Int get_Event_dszB ( Event* ev ) {
    switch (ev->tag) {
       case Ev_Dr: return ev->Ev.Dr.szB;
@@ -572,11 +518,72 @@ static Int get_Event_dszB ( Event* ev ) {
 
 
 /* Up to this many unnotified events are allowed.  Number is
-   arbitrary.  Larger numbers allow more event merging to occur, but
-   potentially induce more spilling due to extending live ranges of
-   address temporaries. */
-#define N_EVENTS 16
+   arbitrary.  Larger numbers allow more event merging to occur, and
+   with --cache-sim=yes fewer calls of log_cache_events.  Addresses are
+   stored to sim_addrs as soon as they are seen, so this does not extend
+   the live ranges of address temporaries. */
+#define N_EVENTS 64
+
+
+/* The data addresses of the cache accesses of the SimGroup about to be
+   simulated, in order.  The instrumentation stores each address here as
+   the access happens; the whole group is then simulated at the next flush
+   point by log_cache_events.  This avoids a helper call per event, and
+   keeps the address temporaries short-lived.  One buffer is enough as
+   the flush points include every exit from the SB, so that the buffer
+   is never live across a thread switch. */
+static Addr sim_addrs[N_EVENTS];
+
+/* I1 and D1 are independent, so the instruction reads of a group and its
+   data accesses can each be simulated in a tight loop of their own, in
+   order.  Only the LL accesses made on their (rare) misses have to be
+   done in the order of the accesses, which gives the same results as
+   simulating each access in turn. */
+static VG_REGPARM(1)
+void log_cache_events(SimGroup* g)
+{
+   const SimEvent* Ir = g->events;
+   const SimEvent* D  = g->events + g->n_Ir;
+   Int Ir_miss[N_EVENTS], D_miss[N_EVENTS];
+   Int i, j, n_Ir_miss = 0, n_D_miss = 0;
+
+   for (i = 0; i < g->n_hits; i++)
+      g->hits[i].cc->a += g->hits[i].n;
+
+   for (i = 0; i < g->n_Ir; i++) {
+      Bool miss = Ir[i].NoX ? cachesim_I1_NoX_is_miss(Ir[i].addr)
+                            : cachesim_ref_is_miss(&I1, Ir[i].addr, Ir[i].size);
+      Ir[i].cc->a++;
+      if (UNLIKELY(miss)) {
+         Ir[i].cc->m1++;
+         Ir_miss[n_Ir_miss++] = i;
+      }
+   }
+   for (i = 0; i < g->n_D; i++) {
+      Bool miss = cachesim_ref_is_miss(&D1, sim_addrs[i], D[i].size);
+      D[i].cc->a++;
+      if (UNLIKELY(miss)) {
+         D[i].cc->m1++;
+         D_miss[n_D_miss++] = i;
+      }
+   }
 
+   /* Merge the two lists of misses by position. */
+   i = j = 0;
+   while (i < n_Ir_miss || j < n_D_miss) {
+      if (j == n_D_miss
+          || (i < n_Ir_miss && Ir[Ir_miss[i]].pos < D[D_miss[j]].pos)) {
+         const SimEvent* ev = &Ir[Ir_miss[i++]];
+         if (ev->NoX ? cachesim_LL_NoX_is_miss(ev->addr)
+                     : cachesim_ref_is_miss(&LL, ev->addr, ev->size))
+            ev->cc->mL++;
+      } else {
+         Int k = D_miss[j++];
+         if (cachesim_ref_is_miss(&LL, sim_addrs[k], D[k].size))
+            D[k].cc->mL++;
+      }
+   }
+}
 
 /* A struct which holds all the running state during instrumentation.
    Mostly to avoid passing loads of parameters everywhere. */
@@ -586,6 +593,9 @@ typedef
       Event events[N_EVENTS];
       Int   events_used;
 
+      /* Number of sim_addrs slots used by the events in the list. */
+      Int   sim_addrs_used;
+
       /* The array of InstrInfo bins for the BB. */
       SB_info* sbInfo;
 
@@ -631,6 +641,7 @@ SB_info* get_SB_info(IRSB* sbIn, Addr origAddr)
                                 sizeof(SB_info) + n_instrs*sizeof(InstrInfo)); 
    sbInfo->SB_addr  = origAddr;
    sbInfo->n_instrs = n_instrs;
+   sbInfo->groups   = NULL;
    VG_(OSetGen_Insert)( instrInfoTable, sbInfo );
 
    return sbInfo;
@@ -693,6 +704,119 @@ InstrInfo* setup_InstrInfo ( CgState* cgs, Addr instr_addr, UInt instr_len )
 }
 
 
+/* With --cache-sim=yes, generate a call simulating all the outstanding
+   cache accesses, and remove them from the queue, leaving only branch
+   events in it.  The data addresses have already been stored to
+   sim_addrs by addEvent_Dr/addEvent_Dw. */
+
+static void flushCacheEvents ( CgState* cgs )
+{
+   Int       i, j, pos, n_Ir = 0, n_D = 0, n_hit = 0, n_other = 0;
+   Bool      hit[N_EVENTS];
+   Bool      have_line = False;
+   UWord     line = 0;
+   SimGroup* g;
+   IRDirty*  di;
+
+   /* Find the instruction reads known to hit, see SimGroup. */
+   for (i = 0; i < cgs->events_used; i++) {
+      Event* ev = &cgs->events[i];
+      hit[i] = False;
+      switch (ev->tag) {
+         case Ev_IrNoX:
+         case Ev_IrGen: {
+            Addr  a     = ev->inode->instr_addr;
+            UWord first = a >> I1.line_size_bits;
+            UWord last  = (a + ev->inode->instr_len - 1) >> I1.line_size_bits;
+            if (have_line && first == line && last == line) {
+               hit[i] = True;
+               n_hit++;
+            } else {
+               n_Ir++;
+            }
+            have_line = True;
+            line      = last;
+            break;
+         }
+         case Ev_Dr: case Ev_Dw: case Ev_Dm: n_D++; break;
+         default: break;
+      }
+   }
+   tl_assert(n_D == cgs->sim_addrs_used);
+   if (n_Ir + n_D + n_hit == 0)
+      return;
+
+   g = VG_(malloc)("cg.flushCacheEvents.1",
+                   sizeof(SimGroup) + (n_Ir + n_D) * sizeof(SimEvent)
+                   + n_hit * sizeof(SimHits));
+   g->n_Ir   = n_Ir;
+   g->n_D    = n_D;
+   g->hits   = (SimHits*)&g->events[n_Ir + n_D];
+   g->n_hits = 0;
+   g->next   = cgs->sbInfo->groups;
+   cgs->sbInfo->groups = g;
+
+   n_Ir = n_D = pos = 0;
+   for (i = 0; i < cgs->events_used; i++) {
+      Event*     ev    = &cgs->events[i];
+      InstrInfo* inode = ev->inode;
+      SimEvent*  sev;
+
+      if (DEBUG_CG) {
+         VG_(printf)("   flush ");
+         showEvent( ev );
+      }
+
+      if (hit[i]) {
+         CacheCC* cc = &inode->parent->Ir;
+         for (j = 0; j < g->n_hits && g->hits[j].cc != cc; j++)
+            ;
+         if (j == g->n_hits) {
+            g->hits[j].cc = cc;
+            g->hits[j].n  = 0;
+            g->n_hits++;
+         }
+         g->hits[j].n++;
+         continue;
+      }
+
+      switch (ev->tag) {
+         case Ev_IrNoX:
+         case Ev_IrGen:
+            sev       = &g->events[n_Ir++];
+            sev->addr = inode->instr_addr;
+            sev->size = inode->instr_len;
+            sev->NoX  = ev->tag == Ev_IrNoX;
+            sev->cc   = &inode->parent->Ir;
+            break;
+         case Ev_Dr:
+         case Ev_Dm:
+         case Ev_Dw:
+            /* Data read, modify (counted as a read) or write */
+            sev       = &g->events[g->n_Ir + n_D++];
+            sev->addr = 0;
+            sev->size = get_Event_dszB(ev);
+            sev->NoX  = False;
+            sev->cc   = ev->tag == Ev_Dw ? &inode->parent->Dw
+                                         : &inode->parent->Dr;
+            break;
+         default:
+            /* A branch event, keep it for flushEvents. */
+            cgs->events[n_other++] = *ev;
+            continue;
+      }
+      sev->pos = pos++;
+   }
+
+   di = unsafeIRDirty_0_N( 1, "log_cache_events",
+                           VG_(fnptr_to_fnentry)( &log_cache_events ),
+                           mkIRExprVec_1( mkIRExpr_HWord( (HWord)g ) ) );
+   addStmtToIRSB( cgs->sbOut, IRStmt_Dirty(di) );
+
+   cgs->events_used    = n_other;
+   cgs->sim_addrs_used = 0;
+}
+
 /* Generate code for all outstanding memory events, and mark the queue
    empty.  Code is generated into cgs->bbOut, and this activity
    'consumes' slots in cgs->sbInfo. */
@@ -709,6 +833,9 @@ static void flushEvents ( CgState* cgs )
    Event*     ev2;
    Event*     ev3;
 
+   if (clo_cache_sim)
+      flushCacheEvents(cgs);
+
    i = 0;
    while (i < cgs->events_used) {
 
@@ -733,51 +860,15 @@ static void flushEvents ( CgState* cgs )
       i_node_expr = mkIRExpr_HWord( (HWord)ev->inode );
 
       /* Decide on helper fn to call and args to pass it, and advance
-         i appropriately. */
+         i appropriately.  Only instruction counts (with --cache-sim=no)
+         and branches are left at this point. */
       switch (ev->tag) {
          case Ev_IrNoX:
-            /* Merge an IrNoX with a following Dr/Dm. */
-            if (ev2 && (ev2->tag == Ev_Dr || ev2->tag == Ev_Dm)) {
-               /* Why is this true?  It's because we're merging an Ir
-                  with a following Dr or Dm.  The Ir derives from the
-                  instruction's IMark and the Dr/Dm from data
-                  references which follow it.  In short it holds
-                  because each insn starts with an IMark, hence an
-                  Ev_Ir, and so these Dr/Dm must pertain to the
-                  immediately preceding Ir.  Same applies to analogous
-                  assertions in the subsequent cases. */
-               tl_assert(ev2->inode == ev->inode);
-               helperName = "log_1IrNoX_1Dr_cache_access";
-               helperAddr = &log_1IrNoX_1Dr_cache_access;
-               argv = mkIRExprVec_3( i_node_expr,
-                                     get_Event_dea(ev2),
-                                     mkIRExpr_HWord( get_Event_dszB(ev2) ) );
-               regparms = 3;
-               i += 2;
-            }
-            /* Merge an IrNoX with a following Dw. */
-            else
-            if (ev2 && ev2->tag == Ev_Dw) {
-               tl_assert(ev2->inode == ev->inode);
-               helperName = "log_1IrNoX_1Dw_cache_access";
-               helperAddr = &log_1IrNoX_1Dw_cache_access;
-               argv = mkIRExprVec_3( i_node_expr,
-                                     get_Event_dea(ev2),
-                                     mkIRExpr_HWord( get_Event_dszB(ev2) ) );
-               regparms = 3;
-               i += 2;
-            }
             /* Merge an IrNoX with two following IrNoX's. */
-            else
             if (ev2 && ev3 && ev2->tag == Ev_IrNoX && ev3->tag == Ev_IrNoX)
             {
-               if (clo_cache_sim) {
-                  helperName = "log_3IrNoX_0D_cache_access";
-                  helperAddr = &log_3IrNoX_0D_cache_access;
-               } else {
-                  helperName = "log_3Ir";
-                  helperAddr = &log_3Ir;
-               }
+               helperName = "log_3Ir";
+               helperAddr = &log_3Ir;
                argv = mkIRExprVec_3( i_node_expr, 
                                      mkIRExpr_HWord( (HWord)ev2->inode ), 
                                      mkIRExpr_HWord( (HWord)ev3->inode ) );
@@ -787,13 +878,8 @@ static void flushEvents ( CgState* cgs )
             /* Merge an IrNoX with one following IrNoX. */
             else
             if (ev2 && ev2->tag == Ev_IrNoX) {
-               if (clo_cache_sim) {
-                  helperName = "log_2IrNoX_0D_cache_access";
-                  helperAddr = &log_2IrNoX_0D_cache_access;
-               } else {
-                  helperName = "log_2Ir";
-                  helperAddr = &log_2Ir;
-               }
+               helperName = "log_2Ir";
+               helperAddr = &log_2Ir;
                argv = mkIRExprVec_2( i_node_expr,
                                      mkIRExpr_HWord( (HWord)ev2->inode ) );
                regparms = 2;
@@ -801,49 +887,18 @@ static void flushEvents ( CgState* cgs )
             }
             /* No merging possible; emit as-is. */
             else {
-               if (clo_cache_sim) {
-                  helperName = "log_1IrNoX_0D_cache_access";
-                  helperAddr = &log_1IrNoX_0D_cache_access;
-               } else {
-                  helperName = "log_1Ir";
-                  helperAddr = &log_1Ir;
-               }
+               helperName = "log_1Ir";
+               helperAddr = &log_1Ir;
                argv = mkIRExprVec_1( i_node_expr );
                regparms = 1;
                i++;
             }
             break;
          case Ev_IrGen:
-            if (clo_cache_sim) {
-	       helperName = "log_1IrGen_0D_cache_access";
-	       helperAddr = &log_1IrGen_0D_cache_access;
-	    } else {
-	       helperName = "log_1Ir";
-	       helperAddr = &log_1Ir;
-	    }
-	    argv = mkIRExprVec_1( i_node_expr );
-	    regparms = 1;
-	    i++;
-            break;
-         case Ev_Dr:
-         case Ev_Dm:
-            /* Data read or modify */
-            helperName = "log_0Ir_1Dr_cache_access";
-            helperAddr = &log_0Ir_1Dr_cache_access;
-            argv = mkIRExprVec_3( i_node_expr, 
-                                  get_Event_dea(ev), 
-                                  mkIRExpr_HWord( get_Event_dszB(ev) ) );
-            regparms = 3;
-            i++;
-            break;
-         case Ev_Dw:
-            /* Data write */
-            helperName = "log_0Ir_1Dw_cache_access";
-            helperAddr = &log_0Ir_1Dw_cache_access;
-            argv = mkIRExprVec_3( i_node_expr,
-                                  get_Event_dea(ev), 
-                                  mkIRExpr_HWord( get_Event_dszB(ev) ) );
-            regparms = 3;
+            helperName = "log_1Ir";
+            helperAddr = &log_1Ir;
+            argv = mkIRExprVec_1( i_node_expr );
+            regparms = 1;
             i++;
             break;
          case Ev_Bc:
@@ -898,6 +953,18 @@ static void addEvent_Ir ( CgState* cgs, InstrInfo* inode )
    cgs->events_used++;
 }
 
+/* Generate code to store the address of a new data access event to its
+   slot in sim_addrs. */
+static void addSimAddr ( CgState* cgs, IRAtom* ea )
+{
+   tl_assert(cgs->sim_addrs_used >= 0 && cgs->sim_addrs_used < N_EVENTS);
+   addStmtToIRSB( cgs->sbOut,
+                  IRStmt_Store( CGEndness,
+                                mkIRExpr_HWord( (HWord)&sim_addrs[cgs->sim_addrs_used] ),
+                                ea ) );
+   cgs->sim_addrs_used++;
+}
+
 static
 void addEvent_Dr ( CgState* cgs, InstrInfo* inode, Int datasize, IRAtom* ea )
 {
@@ -919,6 +986,7 @@ void addEvent_Dr ( CgState* cgs, InstrInfo* inode, Int datasize, IRAtom* ea )
    evt->Ev.Dr.szB = datasize;
    evt->Ev.Dr.ea  = ea;
    cgs->events_used++;
+   addSimAddr(cgs, ea);
 }
 
 static
@@ -955,6 +1023,7 @@ void addEvent_Dw ( CgState* cgs, InstrInfo* inode, Int datasize, IRAtom* ea )
    evt->Ev.Dw.szB = datasize;
    evt->Ev.Dw.ea  = ea;
    cgs->events_used++;
+   addSimAddr(cgs, ea);
 }
 
 static
@@ -1096,8 +1165,9 @@ IRSB* cg_instrument ( VgCallbackClosure* closure,
 
    // Set up running state and get block info
    tl_assert(closure->readdr == vge->base[0]);
-   cgs.events_used = 0;
-   cgs.sbInfo      = get_SB_info(sbIn, (Addr)closure->readdr);
+   cgs.events_used    = 0;
+   cgs.sim_addrs_used = 0;
+   cgs.sbInfo         = get_SB_info(sbIn, (Addr)closure->readdr);
    cgs.sbInfo_i    = 0;
 
    if (DEBUG_CG)
@@ -1749,6 +1819,11 @@ void cg_discard_superblock_info ( Addr orig_addr64, VexGuestExtents vge )
    SB_info* sbInfo = VG_(OSetGen_Remove)(instrInfoTable, &orig_addr);
    if (sbInfo) {
       tl_assert(instr_enabled);
+      while (sbInfo->groups) {
+         SimGroup* next = sbInfo->groups->next;
+         VG_(free)(sbInfo->groups);
+         sbInfo->groups = next;
+      }
       VG_(OSetGen_FreeNode)(instrInfoTable, sbInfo);
    } else {
       tl_assert(!instr_enabled);
@@ -0,0 +1,181 @@
+/*--------------------------------------------------------------------*/
+/*--- Cache set simulation                             cg_setsim.c ---*/
+/*--------------------------------------------------------------------*/
+
+/*
+   This file is part of Cachegrind, a high-precision tracing profiler
+   built with Valgrind.
+
+   Copyright (C) 2002-2017 Nicholas Nethercote
+      njn@valgrind.org
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+   The GNU General Public License is contained in the file COPYING.
+*/
+
+/* This file contains the lookup and replacement of lines in the sets of
+   a simulated cache.  It is #included directly into cg_main.c, and into
+   callgrind/sim.c, so that both tools simulate caches the same way.
+
+   A set is 'assoc' consecutive tags.  The most recently used line of a
+   set is always kept in way 0, so that hitting it again, by far the most
+   common case, costs a single compare.  Empty ways hold tag 0.
+
+   Tags are opaque here, except that the bits in 'flags' are ignored when
+   comparing them, and that the bits in 'ref' are or'ed into the tag of
+   the line referenced (Callgrind marks dirty lines this way).
+
+   The replacement policies (see --cache-replacement) are:
+
+   - lru:    the set is kept in LRU order, the line referenced being moved
+             to the front and the last one being replaced on a miss.
+   - plru:   bit pseudo-LRU.  Each way has a bit in 'used', set when it is
+             referenced; when all the bits of a set are set, all but the
+             one just set are cleared.  The victim is the first way whose
+             bit is clear.  'used' is only needed for this policy.
+   - random: the victim is chosen by a pseudo-random number generator
+             with a fixed seed, so that results are reproducible.
+
+   For the last two, the line referenced is swapped with way 0, which
+   leaves the others in place.
+
+   Sets are searched with scalar compares: the MRU compare catches most
+   references, and the other ones are dominated by the loads of the tags,
+   so vector compares (of 64-bit tags, which SSE2 cannot do) do not pay.
+*/
+
+static UInt setsim_seed = 0;
+
+static void setsim_clear(UWord* tags, UChar* used, Int sets, Int assoc)
+{
+   Int i;
+
+   for (i = 0; i < sets * assoc; i++)
+      tags[i] = 0;
+   if (used) {
+      for (i = 0; i < sets * assoc; i++)
+         used[i] = 0;
+   }
+   setsim_seed = 0;
+}
+
+/* Returns the way to replace on a miss in a set, for the policies other
+   than LRU. */
+static __inline__
+Int setsim_victim(const UChar* used, Int assoc, cache_repl_t repl)
+{
+   Int w;
+
+   switch (repl) {
+      case Repl_PLRU:
+         for (w = 0; w < assoc - 1 && used[w]; w++)
+            ;
+         return w;
+      case Repl_Random:
+      default:
+         setsim_seed = 1103515245 * setsim_seed + 12345;
+         return (setsim_seed >> 16) % assoc;
+   }
+}
+
+/* setsim_ref for the policies other than LRU, after the MRU compare. */
+__attribute__((noinline))
+static Bool setsim_ref_other(UWord* set, UChar* used, Int assoc,
+                             cache_repl_t repl, UWord tag, UWord flags,
+                             UWord ref, UWord* evicted)
+{
+   Int   i, w;
+   Bool  miss;
+   UWord t;
+
+   for (w = 1; w < assoc && (set[w] & ~flags) != tag; w++)
+      ;
+   miss = w == assoc;
+   if (miss) {
+      w = setsim_victim(used, assoc, repl);
+      if (evicted)
+         *evicted = set[w];
+      t = tag | ref;
+   } else {
+      t = set[w] | ref;
+   }
+
+   if (repl == Repl_PLRU) {
+      used[w] = 1;
+      for (i = 0; i < assoc && used[i]; i++)
+         ;
+      if (i == assoc) {
+         for (i = 0; i < assoc; i++)
+            used[i] = 0;
+         used[w] = 1;
+      }
+      used[w] = used[0];
+      used[0] = 1;
+   }
+   set[w] = set[0];
+   set[0] = t;
+
+   return miss;
+}
+
+/* References tag in the set whose first way is at index 'first' of tags
+   (and used), installing it on a miss.  Returns True on a miss, and then
+   stores the tag of the line replaced in *evicted, if evicted is
+   non-NULL.  LRU, the default, is inlined; the other policies are not,
+   to keep the callers, which inline several references, small. */
+__attribute__((always_inline))
+static __inline__
+Bool setsim_ref(UWord* tags, UChar* used, UInt first, Int assoc,
+                cache_repl_t repl, UWord tag, UWord flags, UWord ref,
+                UWord* evicted)
+{
+   UWord* set = &tags[first];
+   UWord  t;
+   Int    i, j;
+
+   if (LIKELY((set[0] & ~flags) == tag)) {
+      set[0] |= ref;
+      return False;
+   }
+
+   if (UNLIKELY(repl != Repl_LRU))
+      return setsim_ref_other(set, repl == Repl_PLRU ? &used[first] : NULL,
+                              assoc, repl, tag, flags, ref, evicted);
+
+   /* If the tag is one other than the MRU, move it into the MRU spot
+      and shuffle the rest down. */
+   for (i = 1; i < assoc; i++) {
+      if ((set[i] & ~flags) == tag) {
+         t = set[i] | ref;
+         for (j = i; j > 0; j--)
+            set[j] = set[j - 1];
+         set[0] = t;
+         return False;
+      }
+   }
+
+   /* A miss; install this tag as MRU, shuffle rest down. */
+   if (evicted)
+      *evicted = set[assoc - 1];
+   for (j = assoc - 1; j > 0; j--)
+      set[j] = set[j - 1];
+   set[0] = tag | ref;
+
+   return True;
+}
+
+/*--------------------------------------------------------------------*/
+/*--- end                                              cg_setsim.c ---*/
+/*--------------------------------------------------------------------*/
@@ -45,17 +45,24 @@ typedef struct {
    Int          line_size_bits;
    Int          tag_shift;
    HChar        desc_line[128];         /* large enough */
-   UWord*       tags;
+   cache_repl_t repl;
+   UWord*       tags;                   /* see cg_setsim.c */
+   UChar*       used;
 } cache_t2;
 
 /* By this point, the size/assoc/line_size has been checked. */
 static void cachesim_initcache(cache_t config, cache_t2* c)
 {
-   Int i;
+   static const HChar* const repl_desc[] = {
+      [Repl_LRU]    = "",
+      [Repl_PLRU]   = ", pseudo-LRU",
+      [Repl_Random] = ", random replacement",
+   };
 
    c->size      = config.size;
    c->assoc     = config.assoc;
    c->line_size = config.line_size;
+   c->repl      = VG_(clo_cache_replacement);
 
    c->sets           = (c->size / c->line_size) / c->assoc;
    c->sets_min_1     = c->sets - 1;
@@ -66,15 +73,18 @@ static void cachesim_initcache(cache_t config, cache_t2* c)
       VG_(sprintf)(c->desc_line, "%d B, %d B, direct-mapped", 
                                  c->size, c->line_size);
    } else {
-      VG_(sprintf)(c->desc_line, "%d B, %d B, %d-way associative",
-                                 c->size, c->line_size, c->assoc);
+      VG_(sprintf)(c->desc_line, "%d B, %d B, %d-way associative%s",
+                                 c->size, c->line_size, c->assoc,
+                                 repl_desc[c->repl]);
    }
 
    c->tags = VG_(malloc)("cg.sim.ci.1",
                          sizeof(UWord) * c->sets * c->assoc);
+   c->used = c->repl == Repl_PLRU
+             ? VG_(malloc)("cg.sim.ci.2", c->sets * c->assoc)
+             : NULL;
 
-   for (i = 0; i < c->sets * c->assoc; i++)
-      c->tags[i] = 0;
+   setsim_clear(c->tags, c->used, c->sets, c->assoc);
 }
 
 /* This attribute forces GCC to inline the function, getting rid of a
@@ -86,37 +96,8 @@ __attribute__((always_inline))
 static __inline__
 Bool cachesim_setref_is_miss(cache_t2* c, UInt set_no, UWord tag)
 {
-   int i, j;
-   UWord *set;
-
-   set = &(c->tags[set_no * c->assoc]);
-
-   /* This loop is unrolled for just the first case, which is the most */
-   /* common.  We can't unroll any further because it would screw up   */
-   /* if we have a direct-mapped (1-way) cache.                        */
-   if (tag == set[0])
-      return False;
-
-   /* If the tag is one other than the MRU, move it into the MRU spot  */
-   /* and shuffle the rest down.                                       */
-   for (i = 1; i < c->assoc; i++) {
-      if (tag == set[i]) {
-         for (j = i; j > 0; j--) {
-            set[j] = set[j - 1];
-         }
-         set[0] = tag;
-
-         return False;
-      }
-   }
-
-   /* A miss;  install this tag as MRU, shuffle rest down. */
-   for (j = c->assoc - 1; j > 0; j--) {
-      set[j] = set[j - 1];
-   }
-   set[0] = tag;
-
-   return True;
+   return setsim_ref(c->tags, c->used, set_no * c->assoc, c->assoc, c->repl,
+                     tag, 0, 0, NULL);
 }
 
 __attribute__((always_inline))
@@ -212,6 +193,26 @@ void cachesim_D1_doref(Addr a, UChar size, ULong* m1, ULong *mL)
    }
 }
 
+/* The first and second level parts of cachesim_I1_doref_NoX, for callers
+ * that simulate the LL accesses made on I1 misses separately.
+ */
+__attribute__((always_inline))
+static __inline__
+Bool cachesim_I1_NoX_is_miss(Addr a)
+{
+   UWord block = a >> I1.line_size_bits;
+   return cachesim_setref_is_miss(&I1, block & I1.sets_min_1, block);
+}
+
+__attribute__((always_inline))
+static __inline__
+Bool cachesim_LL_NoX_is_miss(Addr a)
+{
+   // can use block as tag as L1I and LL cache line sizes are equal
+   UWord block = a >> LL.line_size_bits;
+   return cachesim_setref_is_miss(&LL, block & LL.sets_min_1, block);
+}
+
 /* Check for special case IrNoX. Called at instrumentation time.
  *
  * Does this Ir only touch one cache line, and are L1I/LL cache
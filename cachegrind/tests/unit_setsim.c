@@ -0,0 +1,177 @@
+/* Unit test, and benchmark, of the cache set simulation shared by
+   Cachegrind and Callgrind (cg_setsim.c).
+
+   With LRU replacement, the results of every reference are checked
+   against a simple model keeping each set in MRU order, as both tools
+   did before: whether it misses, and which line it evicts.  With the
+   other policies, every reference must hit exactly when its line is in
+   the set.  Both are done with and without a dirty flag in the tags, as
+   used by Callgrind's write-back simulation.
+
+   usage: unit_setsim [bench]
+   With 'bench', also prints the time per reference, and the miss rate,
+   of the model and of each policy, for a 16-way LL-sized cache. */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "pub_tool_basics.h"
+#include "cachegrind/cg_arch.h"
+#include "cachegrind/cg_setsim.c"
+
+#define DIRTY 1
+
+static UInt seed = 1;
+
+static UInt rnd(void)
+{
+   seed = 1103515245 * seed + 12345;
+   return seed >> 8;
+}
+
+/* The model: sets kept in MRU order, shuffled on every reference. */
+static Bool model_ref(UWord* set, Int assoc, UWord tag, UWord flags,
+                      UWord ref, UWord* evicted)
+{
+   Int   i, j;
+   UWord t;
+
+   for (i = 0; i < assoc; i++) {
+      if ((set[i] & ~flags) == tag) {
+         t = set[i] | ref;
+         for (j = i; j > 0; j--)
+            set[j] = set[j - 1];
+         set[0] = t;
+         return False;
+      }
+   }
+   *evicted = set[assoc - 1];
+   for (j = assoc - 1; j > 0; j--)
+      set[j] = set[j - 1];
+   set[0] = tag | ref;
+   return True;
+}
+
+static Bool in_set(const UWord* set, Int assoc, UWord tag, UWord flags)
+{
+   Int i;
+
+   for (i = 0; i < assoc; i++)
+      if ((set[i] & ~flags) == tag)
+         return True;
+   return False;
+}
+
+/* Makes n references to random lines, spread over twice as many lines as
+   the cache holds, in a cache of the given geometry. */
+static void test(Int sets, Int assoc, cache_repl_t repl, Bool dirty, Int n)
+{
+   UWord* tags  = malloc(sets * assoc * sizeof(UWord));
+   UChar* used  = malloc(sets * assoc);
+   UWord* model = malloc(sets * assoc * sizeof(UWord));
+   UWord  flags = dirty ? DIRTY : 0;
+   Int    i, misses = 0;
+
+   setsim_clear(tags, used, sets, assoc);
+   memcpy(model, tags, sets * assoc * sizeof(UWord));
+
+   for (i = 0; i < n; i++) {
+      /* Not block 0, as empty ways hold tag 0. */
+      UWord  block = 1 + rnd() % (2 * sets * assoc);
+      Int    s     = block & (sets - 1);
+      UWord  tag   = dirty ? block << 4 : block;
+      UWord  ref   = dirty ? rnd() & DIRTY : 0;
+      UWord* set   = &tags[s * assoc];
+      Bool   hit   = in_set(set, assoc, tag, flags);
+      UWord  evicted = 0, model_evicted = 0;
+      Bool   miss;
+
+      miss = setsim_ref(tags, used, s * assoc, assoc, repl,
+                        tag, flags, ref, &evicted);
+      misses += miss;
+      assert(miss == !hit);
+      assert((set[0] & ~flags) == tag);
+      assert(!miss || set[0] == (tag | ref));
+      if (repl == Repl_LRU) {
+         assert(model_ref(&model[s * assoc], assoc, tag, flags, ref,
+                          &model_evicted) == miss);
+         if (miss)
+            assert(evicted == model_evicted);
+      } else if (miss && evicted != 0) {
+         assert(!in_set(set, assoc, evicted & ~flags, flags));
+      }
+   }
+
+   free(tags);
+   free(used);
+   free(model);
+   /* Random references to twice the capacity miss about half the time. */
+   assert(misses > n / 4 && misses < 3 * n / 4);
+}
+
+static double now(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* References to random lines of twice an 8 MB, 16-way cache, as seen by
+   the LL of a program missing in L1 a lot. */
+static void bench(void)
+{
+   enum { SETS = 8192, ASSOC = 16, N = 20 * 1000 * 1000 };
+   static const char* const names[] = { "lru", "plru", "random" };
+   UWord* tags  = malloc(SETS * ASSOC * sizeof(UWord));
+   UChar* used  = malloc(SETS * ASSOC);
+   UWord* refs  = malloc(N * sizeof(UWord));
+   UWord  evicted;
+   Int    i, r, misses = 0;
+   double t0;
+
+   for (i = 0; i < N; i++)
+      refs[i] = 1 + rnd() % (2 * SETS * ASSOC);
+
+   setsim_clear(tags, used, SETS, ASSOC);
+   t0 = now();
+   for (i = 0; i < N; i++)
+      misses += model_ref(&tags[(refs[i] & (SETS - 1)) * ASSOC], ASSOC,
+                          refs[i], 0, 0, &evicted);
+   printf("%-8s %5.1f ns/ref, %4.1f%% misses\n", "model",
+          (now() - t0) * 1e9 / N, 100.0 * misses / N);
+
+   for (r = Repl_LRU; r <= Repl_Random; r++) {
+      setsim_clear(tags, used, SETS, ASSOC);
+      misses = 0;
+      t0 = now();
+      for (i = 0; i < N; i++)
+         misses += setsim_ref(tags, used, (refs[i] & (SETS - 1)) * ASSOC,
+                              ASSOC, r, refs[i], 0, 0, NULL);
+      printf("%-8s %5.1f ns/ref, %4.1f%% misses\n", names[r],
+             (now() - t0) * 1e9 / N, 100.0 * misses / N);
+   }
+}
+
+int main(int argc, char** argv)
+{
+   static const Int assocs[] = { 1, 2, 3, 4, 6, 8, 12, 16, 20, 24, 32 };
+   static const struct { cache_repl_t repl; const char* name; } repls[] = {
+      { Repl_LRU, "lru" }, { Repl_PLRU, "plru" }, { Repl_Random, "random" }
+   };
+   Int r, a, d;
+
+   for (r = 0; r < 3; r++) {
+      for (d = 0; d < 2; d++)
+         for (a = 0; a < sizeof(assocs) / sizeof(assocs[0]); a++)
+            test(4, assocs[a], repls[r].repl, d, 5000);
+      printf("%s: ok\n", repls[r].name);
+   }
+
+   if (argc > 1 && strcmp(argv[1], "bench") == 0)
+      bench();
+
+   return 0;
+}
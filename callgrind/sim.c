@@ -44,6 +44,9 @@
 /* Cache configuration */
 #include "cg_arch.c"
 
+/* Lookup and replacement in cache sets */
+#include "cg_setsim.c"
+
 /* additional structures for cache use info, separated
  * according usage frequency:
  * - line_loaded : pointer to cost center of instruction 
@@ -75,7 +78,9 @@ typedef struct {
    int          tag_shift;
    UWord        tag_mask;
    HChar        desc_line[128];    // large enough
-   UWord*       tags;
+   cache_repl_t repl;
+   UWord*       tags;              // see cg_setsim.c
+   UChar*       used;
 
   /* for cache use */
    int          line_size_mask;
@@ -153,9 +158,9 @@ static void cachesim_clearcache(cache_t2* c)
 {
   Int i;
 
-  for (i = 0; i < c->sets * c->assoc; i++)
-    c->tags[i] = 0;
-  if (c->use) {
+  if (!c->use)
+    setsim_clear(c->tags, c->used, c->sets, c->assoc);
+  else {
     for (i = 0; i < c->sets * c->assoc; i++) {
       c->loaded[i].memline  = 0;
       c->loaded[i].use_base = 0;
@@ -173,10 +178,17 @@ static void cacheuse_initcache(cache_t2* c);
 /* By this point, the size/assoc/line_size has been checked. */
 static void cachesim_initcache(cache_t config, cache_t2* c)
 {
+   static const HChar* const repl_desc[] = {
+      [Repl_LRU]    = "",
+      [Repl_PLRU]   = ", pseudo-LRU",
+      [Repl_Random] = ", random replacement",
+   };
+
    c->size      = config.size;
    c->assoc     = config.assoc;
    c->line_size = config.line_size;
    c->sectored  = False; // FIXME
+   c->repl      = VG_(clo_cache_replacement);
 
    c->sets           = (c->size / c->line_size) / c->assoc;
    c->sets_min_1     = c->sets - 1;
@@ -193,13 +205,16 @@ static void cachesim_initcache(cache_t config, cache_t2* c)
 		   c->size, c->line_size,
 		   c->sectored ? ", sectored":"");
    } else {
-      VG_(sprintf)(c->desc_line, "%d B, %d B, %d-way associative%s",
+      VG_(sprintf)(c->desc_line, "%d B, %d B, %d-way associative%s%s",
 		   c->size, c->line_size, c->assoc,
-		   c->sectored ? ", sectored":"");
+		   c->sectored ? ", sectored":"", repl_desc[c->repl]);
    }
 
    c->tags = (UWord*) CLG_MALLOC("cl.sim.cs_ic.1",
                                  sizeof(UWord) * c->sets * c->assoc);
+   c->used = c->repl == Repl_PLRU
+             ? (UChar*) CLG_MALLOC("cl.sim.cs_ic.2", c->sets * c->assoc)
+             : NULL;
    if (clo_collect_cacheuse)
        cacheuse_initcache(c);
    else
@@ -245,36 +260,8 @@ __attribute__((always_inline))
 static __inline__
 CacheResult cachesim_setref(cache_t2* c, UInt set_no, UWord tag)
 {
-    int i, j;
-    UWord *set;
-
-    set = &(c->tags[set_no * c->assoc]);
-
-    /* This loop is unrolled for just the first case, which is the most */
-    /* common.  We can't unroll any further because it would screw up   */
-    /* if we have a direct-mapped (1-way) cache.                        */
-    if (tag == set[0])
-        return Hit;
-
-    /* If the tag is one other than the MRU, move it into the MRU spot  */
-    /* and shuffle the rest down.                                       */
-    for (i = 1; i < c->assoc; i++) {
-        if (tag == set[i]) {
-            for (j = i; j > 0; j--) {
-                set[j] = set[j - 1];
-            }
-            set[0] = tag;
-            return Hit;
-        }
-    }
-
-    /* A miss;  install this tag as MRU, shuffle rest down. */
-    for (j = c->assoc - 1; j > 0; j--) {
-        set[j] = set[j - 1];
-    }
-    set[0] = tag;
-
-    return Miss;
+    return setsim_ref(c->tags, c->used, set_no * c->assoc, c->assoc,
+                      c->repl, tag, 0, 0, NULL) ? Miss : Hit;
 }
 
 __attribute__((always_inline))
@@ -351,39 +338,13 @@ __attribute__((always_inline))
 static __inline__
 CacheResult cachesim_setref_wb(cache_t2* c, RefType ref, UInt set_no, UWord tag)
 {
-    int i, j;
-    UWord *set, tmp_tag;
-
-    set = &(c->tags[set_no * c->assoc]);
+    UWord evicted;
 
-    /* This loop is unrolled for just the first case, which is the most */
-    /* common.  We can't unroll any further because it would screw up   */
-    /* if we have a direct-mapped (1-way) cache.                        */
-    if (tag == (set[0] & ~CACHELINE_DIRTY)) {
-	set[0] |= ref;
+    if (!setsim_ref(c->tags, c->used, set_no * c->assoc, c->assoc,
+                    c->repl, tag, CACHELINE_DIRTY, ref, &evicted))
         return Hit;
-    }
-    /* If the tag is one other than the MRU, move it into the MRU spot  */
-    /* and shuffle the rest down.                                       */
-    for (i = 1; i < c->assoc; i++) {
-	if (tag == (set[i] & ~CACHELINE_DIRTY)) {
-	    tmp_tag = set[i] | ref; // update dirty flag
-            for (j = i; j > 0; j--) {
-                set[j] = set[j - 1];
-            }
-            set[0] = tmp_tag;
-            return Hit;
-        }
-    }
-
-    /* A miss;  install this tag as MRU, shuffle rest down. */
-    tmp_tag = set[c->assoc - 1];
-    for (j = c->assoc - 1; j > 0; j--) {
-        set[j] = set[j - 1];
-    }
-    set[0] = tag | ref;
 
-    return (tmp_tag & CACHELINE_DIRTY) ? MissDirty : Miss;
+    return (evicted & CACHELINE_DIRTY) ? MissDirty : Miss;
 }
 
 __attribute__((always_inline))
@@ -1384,6 +1345,12 @@ static void cachesim_post_clo_init(void)
 	  clo_simulate_writeback = False;
       }
 
+      if (VG_(clo_cache_replacement) != Repl_LRU) {
+	  VG_(message)(Vg_DebugMsg,
+		       "warning: only LRU replacement can be "
+                       "used with cache usage\n");
+      }
+
       simulator.I1_Read  = cacheuse_I1_doRead;
       simulator.D1_Read  = cacheuse_D1_doRead;
       simulator.D1_Write = cacheuse_D1_doRead;
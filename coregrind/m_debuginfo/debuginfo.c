@@ -61,6 +61,7 @@
 # include "priv_readelf.h"
 # include "priv_readdwarf3.h"
 # include "priv_readpdb.h"
+# include "priv_dicache.h"
 #elif defined(VGO_darwin)
 # include "priv_readmacho.h"
 # include "priv_readpdb.h"
@@ -1470,6 +1471,9 @@ void VG_(di_load_di)( DebugInfo *di )
 #if defined(VGO_darwin)
       ML_(read_macho_debug_info) (di);
 #else
+      /* The cached tables are canonicalised and finished already. */
+      if (ML_(dicache_load) (di))
+         return;
       ML_(read_elf_debug) (di);
 #endif
       ML_(canonicaliseTables)( di );
@@ -1479,6 +1483,9 @@ void VG_(di_load_di)( DebugInfo *di )
          priv_storage.h. */
       check_CFSI_related_invariants(di);
       ML_(finish_CFSI_arrays)(di);
+#if !defined(VGO_darwin)
+      ML_(dicache_save) (di);
+#endif
    }
 }
 
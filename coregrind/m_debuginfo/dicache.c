@@ -0,0 +1,688 @@
+/* -*- mode: C; c-basic-offset: 3; -*- */
+
+/*--------------------------------------------------------------------*/
+/*--- On-disk cache of debug info tables.               dicache.c ---*/
+/*--------------------------------------------------------------------*/
+
+/*
+   This file is part of Valgrind, a dynamic binary instrumentation
+   framework.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+   The GNU General Public License is contained in the file COPYING.
+*/
+
+#if defined(VGO_linux) || defined(VGO_solaris) || defined(VGO_freebsd)
+
+#include "pub_core_basics.h"
+#include "pub_core_vki.h"
+#include "pub_core_debuginfo.h"
+#include "pub_core_deduppoolalloc.h"
+#include "pub_core_libcbase.h"
+#include "pub_core_libcassert.h"
+#include "pub_core_libcfile.h"
+#include "pub_core_libcprint.h"
+#include "pub_core_libcproc.h"     /* VG_(getpid) */
+#include "pub_core_options.h"
+#include "pub_core_wordfm.h"
+#include "pub_core_xarray.h"
+#include "priv_misc.h"             /* dinfo_zalloc/free */
+#include "priv_storage.h"
+#include "priv_readelf.h"          /* ML_(find_elf_buildid) */
+#include "priv_dicache.h"          /* self */
+
+/* A cache file holds the tables of a DebugInfo as they are once
+   ML_(canonicaliseTables) and ML_(finish_CFSI_arrays) are done with
+   them, so that loading them is mostly a matter of reading each table
+   straight into its final place.  It is only valid for the Valgrind
+   build that wrote it, which the header checks as well as it cheaply
+   can.  After the header come, without any padding:
+
+      the strings:        hdr.strB bytes, hdr.n_str NUL-terminated
+                          strings, numbered from 0.
+      the symbols:        hdr.n_sym DiSym, whose pri_name holds a string
+                          number and whose sec_names holds 0, or 1 + the
+                          index in the next table of its first name.
+      the secondary names of the symbols:
+                          hdr.n_secname UWord string numbers, each list
+                          ended by NO_STR.
+      the fndnpool:       hdr.n_fndn pairs of UWord string numbers
+                          (filename, dirname or NO_STR).
+      di->loctab:         hdr.n_loc DiLoc.
+      di->loctab_fndn_ix: hdr.n_loc indexes of hdr.sizeof_fndn_ix bytes.
+      di->inltab:         hdr.n_inl DiInlLoc, whose inlinedfn holds a
+                          string number.
+      di->cfsi_base:      hdr.n_cfsi Addr.
+      di->cfsi_m_ix:      hdr.n_cfsi indexes of hdr.sizeof_cfsi_m_ix bytes.
+      the cfsi_m_pool:    hdr.n_cfsi_m DiCfSI_m.
+      di->cfsi_exprs:     hdr.n_expr CfiExpr.
+
+   Strings, filename/dirname pairs and DiCfSI_m are put back in the
+   DebugInfo's pools, in the same order, so that they get back the
+   numbers used in the tables.  All addresses are those of the run that
+   wrote the file; they are relocated if the object is now mapped
+   elsewhere, provided it moved as a whole.
+
+   Variable information is not cached: objects are not cached or looked
+   up in the cache when it is read.
+
+   Several Valgrind processes can share a cache: a file is written
+   under a temporary name and then renamed, so that readers see either
+   the previous file or the new one, complete.  Readers also check that
+   the file has the size its header implies. */
+
+#define DICACHE_MAGIC "VGDICAC1"
+
+/* No string. */
+#define NO_STR ((UWord)-1)
+
+/* The sections whose bias the relocation of the tables depends on. */
+#define N_SECTS 6
+
+typedef
+   struct {
+      HChar    magic[8];
+      /* Sizes of the records, as a check of the layout. */
+      UInt     szB_sym;
+      UInt     szB_loc;
+      UInt     szB_inl;
+      UInt     szB_cfsi_m;
+      UInt     szB_expr;
+      UInt     read_inline_info;
+      /* Where the object was mapped. */
+      Addr     text_avma;
+      SizeT    text_size;
+      UWord    present[N_SECTS];
+      PtrdiffT bias[N_SECTS];
+      /* Sizes of the tables following the header. */
+      UWord    n_str;
+      UWord    strB;
+      UWord    n_sym;
+      UWord    n_secname;
+      UWord    n_fndn;
+      UWord    n_loc;
+      UWord    sizeof_fndn_ix;
+      UWord    n_inl;
+      UWord    maxinl_codesz;
+      UWord    n_cfsi;
+      UWord    sizeof_cfsi_m_ix;
+      UWord    n_cfsi_m;
+      UWord    n_expr;
+      Addr     cfsi_minavma;
+      Addr     cfsi_maxavma;
+   }
+   CacheHdr;
+
+static void get_sects ( const DebugInfo* di,
+                        /*OUT*/UWord* present, /*OUT*/PtrdiffT* bias )
+{
+   present[0] = di->text_present;   bias[0] = di->text_bias;
+   present[1] = di->data_present;   bias[1] = di->data_bias;
+   present[2] = di->sdata_present;  bias[2] = di->sdata_bias;
+   present[3] = di->rodata_present; bias[3] = di->rodata_bias;
+   present[4] = di->bss_present;    bias[4] = di->bss_bias;
+   present[5] = di->sbss_present;   bias[5] = di->sbss_bias;
+}
+
+/* Returns the name of the cache file for DI, in ML_(dinfo_zalloc)'d
+   space, or NULL if DI cannot be cached. */
+static HChar* cache_file_name ( const DebugInfo* di )
+{
+   HChar* buildid;
+   HChar* name;
+
+   if (VG_(clo_debuginfo_cache) == NULL || VG_(clo_read_var_info))
+      return NULL;
+   buildid = ML_(find_elf_buildid)(di->fsm.filename);
+   if (buildid == NULL)
+      return NULL;
+   name = ML_(dinfo_zalloc)("di.dicache.name",
+                            VG_(strlen)(VG_(clo_debuginfo_cache))
+                            + VG_(strlen)(buildid) + 16);
+   VG_(sprintf)(name, "%s/%s%s.vgdi", VG_(clo_debuginfo_cache), buildid,
+                VG_(clo_read_inline_info) ? "-inl" : "");
+   ML_(dinfo_free)(buildid);
+   return name;
+}
+
+/* Reads or writes exactly szB bytes at offset off, or fails. */
+static Bool read_at ( Int fd, void* buf, SizeT szB, OffT off )
+{
+   UChar* p = buf;
+
+   while (szB > 0) {
+      Int    n  = szB > (1 << 30) ? (1 << 30) : (Int)szB;
+      SysRes sr = VG_(pread)(fd, p, n, off);
+      if (sr_isError(sr) || sr_Res(sr) == 0)
+         return False;
+      p   += sr_Res(sr);
+      off += sr_Res(sr);
+      szB -= sr_Res(sr);
+   }
+   return True;
+}
+
+static Bool write_all ( Int fd, const void* buf, SizeT szB )
+{
+   const UChar* p = buf;
+
+   while (szB > 0) {
+      Int n = VG_(write)(fd, p, szB > (1 << 30) ? (1 << 30) : (Int)szB);
+      if (n <= 0)
+         return False;
+      p   += n;
+      szB -= n;
+   }
+   return True;
+}
+
+
+/*------------------------------------------------------------*/
+/*--- Loading                                              ---*/
+/*------------------------------------------------------------*/
+
+/* Allocates and reads a table of n elements of szB bytes, from *off,
+   advancing *off.  Returns NULL for an empty table, and sets *ok to
+   False if the read fails. */
+static void* read_table ( Int fd, /*MOD*/OffT* off, UWord n, SizeT szB,
+                          const HChar* cc, /*MOD*/Bool* ok )
+{
+   void* tab;
+
+   if (!*ok || n == 0)
+      return NULL;
+   tab = ML_(dinfo_zalloc)(cc, n * szB);
+   if (!read_at(fd, tab, n * szB, *off)) {
+      ML_(dinfo_free)(tab);
+      *ok = False;
+      return NULL;
+   }
+   *off += n * szB;
+   return tab;
+}
+
+/* Frees symtab, and the sec_names of its first n entries. */
+static void free_symtab ( DiSym* symtab, UWord n )
+{
+   UWord i;
+
+   if (symtab == NULL)
+      return;
+   for (i = 0; i < n; i++)
+      if (symtab[i].sec_names)
+         ML_(dinfo_free)(symtab[i].sec_names);
+   ML_(dinfo_free)(symtab);
+}
+
+/* Checks that hdr describes tables suitable for DI, and that the file
+   has the size it implies.  Sets *delta to the distance by which their
+   addresses have to be relocated. */
+static Bool hdr_ok ( const DebugInfo* di, const CacheHdr* hdr,
+                     Long file_szB, /*OUT*/PtrdiffT* delta )
+{
+   UWord    present[N_SECTS];
+   PtrdiffT bias[N_SECTS];
+   ULong    szB;
+   Int      i;
+
+   if (VG_(memcmp)(hdr->magic, DICACHE_MAGIC, sizeof(hdr->magic)) != 0
+       || hdr->szB_sym != sizeof(DiSym)
+       || hdr->szB_loc != sizeof(DiLoc)
+       || hdr->szB_inl != sizeof(DiInlLoc)
+       || hdr->szB_cfsi_m != sizeof(DiCfSI_m)
+       || hdr->szB_expr != sizeof(CfiExpr)
+       || hdr->read_inline_info != VG_(clo_read_inline_info)
+       || hdr->text_size != di->text_size
+       || (hdr->sizeof_fndn_ix != 1 && hdr->sizeof_fndn_ix != 2
+           && hdr->sizeof_fndn_ix != 4)
+       || (hdr->n_cfsi > 0 && hdr->sizeof_cfsi_m_ix != 1
+           && hdr->sizeof_cfsi_m_ix != 2 && hdr->sizeof_cfsi_m_ix != 4))
+      return False;
+
+   /* The object must have moved as a whole. */
+   *delta = di->text_avma - hdr->text_avma;
+   get_sects(di, present, bias);
+   for (i = 0; i < N_SECTS; i++) {
+      if (present[i] != hdr->present[i])
+         return False;
+      if (present[i] && bias[i] - hdr->bias[i] != *delta)
+         return False;
+   }
+
+   szB = sizeof(CacheHdr) + hdr->strB
+         + hdr->n_sym * sizeof(DiSym)
+         + hdr->n_secname * sizeof(UWord)
+         + hdr->n_fndn * 2 * sizeof(UWord)
+         + hdr->n_loc * (sizeof(DiLoc) + hdr->sizeof_fndn_ix)
+         + hdr->n_inl * sizeof(DiInlLoc)
+         + hdr->n_cfsi * (sizeof(Addr) + hdr->sizeof_cfsi_m_ix)
+         + hdr->n_cfsi_m * sizeof(DiCfSI_m)
+         + hdr->n_expr * sizeof(CfiExpr);
+   return szB == (ULong)file_szB;
+}
+
+Bool ML_(dicache_load) ( DebugInfo* di )
+{
+   HChar*       name;
+   SysRes       fd;
+   struct vg_stat st;
+   CacheHdr     hdr;
+   PtrdiffT     delta = 0;
+   OffT         off;
+   UWord        n_sym_done = 0;
+   Bool         ok = True;
+   UWord        i, j;
+   HChar*       strB    = NULL;
+   const HChar** strs   = NULL;
+   DiSym*       symtab  = NULL;
+   UWord*       secnames = NULL;
+   UWord*       fndns   = NULL;
+   DiLoc*       loctab  = NULL;
+   void*        loctab_fndn_ix = NULL;
+   DiInlLoc*    inltab  = NULL;
+   Addr*        cfsi_base = NULL;
+   void*        cfsi_m_ix = NULL;
+   DiCfSI_m*    cfsi_m  = NULL;
+   CfiExpr*     exprs   = NULL;
+
+   name = cache_file_name(di);
+   if (name == NULL)
+      return False;
+   fd = VG_(open)(name, VKI_O_RDONLY, 0);
+   if (sr_isError(fd)) {
+      ML_(dinfo_free)(name);
+      return False;
+   }
+   if (VG_(fstat)(sr_Res(fd), &st) != 0
+       || st.size < (Long)sizeof(hdr)
+       || !read_at(sr_Res(fd), &hdr, sizeof(hdr), 0)
+       || !hdr_ok(di, &hdr, st.size, &delta)) {
+      VG_(close)(sr_Res(fd));
+      ML_(dinfo_free)(name);
+      return False;
+   }
+
+   /* Read all the tables first, so as to leave DI alone if that
+      fails. */
+   off = sizeof(hdr);
+   strB      = read_table(sr_Res(fd), &off, hdr.strB, 1,
+                          "di.dicache.str", &ok);
+   symtab    = read_table(sr_Res(fd), &off, hdr.n_sym, sizeof(DiSym),
+                          "di.dicache.sym", &ok);
+   secnames  = read_table(sr_Res(fd), &off, hdr.n_secname, sizeof(UWord),
+                          "di.dicache.secname", &ok);
+   fndns     = read_table(sr_Res(fd), &off, hdr.n_fndn, 2 * sizeof(UWord),
+                          "di.dicache.fndn", &ok);
+   loctab    = read_table(sr_Res(fd), &off, hdr.n_loc, sizeof(DiLoc),
+                          "di.dicache.loc", &ok);
+   loctab_fndn_ix = read_table(sr_Res(fd), &off, hdr.n_loc,
+                               hdr.sizeof_fndn_ix, "di.dicache.loc_ix",
+                               &ok);
+   inltab    = read_table(sr_Res(fd), &off, hdr.n_inl, sizeof(DiInlLoc),
+                          "di.dicache.inl", &ok);
+   cfsi_base = read_table(sr_Res(fd), &off, hdr.n_cfsi, sizeof(Addr),
+                          "di.dicache.cfsi_base", &ok);
+   cfsi_m_ix = read_table(sr_Res(fd), &off, hdr.n_cfsi,
+                          hdr.sizeof_cfsi_m_ix, "di.dicache.cfsi_m_ix", &ok);
+   cfsi_m    = read_table(sr_Res(fd), &off, hdr.n_cfsi_m, sizeof(DiCfSI_m),
+                          "di.dicache.cfsi_m", &ok);
+   exprs     = read_table(sr_Res(fd), &off, hdr.n_expr, sizeof(CfiExpr),
+                          "di.dicache.expr", &ok);
+   VG_(close)(sr_Res(fd));
+   if (!ok)
+      goto fail;
+
+   /* Put the strings in the string table. */
+   if (hdr.n_str > 0 && (hdr.strB == 0 || strB[hdr.strB - 1] != 0))
+      goto fail;
+   strs = ML_(dinfo_zalloc)("di.dicache.strs",
+                            (hdr.n_str + 1) * sizeof(HChar*));
+   for (i = 0, j = 0; i < hdr.strB; i += VG_(strlen)(&strB[i]) + 1) {
+      if (j == hdr.n_str)
+         goto fail;
+      strs[j++] = ML_(addStr)(di, &strB[i], -1);
+   }
+   if (j != hdr.n_str)
+      goto fail;
+
+#  define STR(_no) ((_no) < hdr.n_str ? strs[_no] : NULL)
+
+   /* The other pools.  The entries must get the same numbers as when
+      the file was written: the pools already hold the entries read by
+      ML_(read_elf_object), which came first then too. */
+   for (i = 0; i < hdr.n_fndn; i++) {
+      const HChar* fn = STR(fndns[2 * i]);
+      const HChar* dn = STR(fndns[2 * i + 1]);
+      if (fn == NULL || (dn == NULL && fndns[2 * i + 1] != NO_STR)
+          || ML_(addFnDn)(di, fn, dn) != i + 1)
+         goto fail;
+   }
+   if (hdr.n_cfsi_m > 0 && di->cfsi_m_pool == NULL)
+      di->cfsi_m_pool = VG_(newDedupPA)(1000 * sizeof(DiCfSI_m),
+                                        vg_alignof(DiCfSI_m),
+                                        ML_(dinfo_zalloc),
+                                        "di.storage.DiCfSI_m_pool",
+                                        ML_(dinfo_free));
+   for (i = 0; i < hdr.n_cfsi_m; i++) {
+      if (VG_(allocFixedEltDedupPA)(di->cfsi_m_pool, sizeof(DiCfSI_m),
+                                    &cfsi_m[i]) != i + 1)
+         goto fail;
+   }
+
+   /* Turn string numbers back into strings, and relocate. */
+   for (i = 0; i < hdr.n_sym; i++) {
+      DiSym* sym   = &symtab[i];
+      UWord  first = (UWord)sym->sec_names;
+      sym->pri_name  = STR((UWord)sym->pri_name);
+      sym->sec_names = NULL;
+      n_sym_done = i + 1;
+      if (sym->pri_name == NULL)
+         goto fail;
+      if (first > 0) {
+         UWord n;
+         for (n = 0; first - 1 + n < hdr.n_secname
+                     && secnames[first - 1 + n] != NO_STR; n++)
+            ;
+         if (n == 0 || first - 1 + n == hdr.n_secname)
+            goto fail;
+         sym->sec_names = ML_(dinfo_zalloc)("di.dicache.sec_names",
+                                            (n + 1) * sizeof(HChar*));
+         for (j = 0; j < n; j++)
+            if ((sym->sec_names[j] = STR(secnames[first - 1 + j])) == NULL)
+               goto fail;
+      }
+      sym->avmas.main += delta;
+      if (GET_TOCPTR_AVMA(sym->avmas) != 0) {
+         SET_TOCPTR_AVMA(sym->avmas, GET_TOCPTR_AVMA(sym->avmas) + delta);
+      }
+      if (GET_LOCAL_EP_AVMA(sym->avmas) != 0) {
+         SET_LOCAL_EP_AVMA(sym->avmas,
+                           GET_LOCAL_EP_AVMA(sym->avmas) + delta);
+      }
+   }
+   for (i = 0; i < hdr.n_inl; i++) {
+      inltab[i].inlinedfn = STR((UWord)inltab[i].inlinedfn);
+      if (inltab[i].inlinedfn == NULL)
+         goto fail;
+      inltab[i].addr_lo += delta;
+      inltab[i].addr_hi += delta;
+   }
+   if (delta != 0) {
+      for (i = 0; i < hdr.n_loc; i++)
+         loctab[i].addr += delta;
+      for (i = 0; i < hdr.n_cfsi; i++)
+         cfsi_base[i] += delta;
+   }
+
+#  undef STR
+
+   /* Replace DI's tables. */
+   free_symtab(di->symtab, di->symtab_used);
+   di->symtab      = symtab;
+   di->symtab_used = di->symtab_size = hdr.n_sym;
+
+   if (di->loctab)         ML_(dinfo_free)(di->loctab);
+   if (di->loctab_fndn_ix) ML_(dinfo_free)(di->loctab_fndn_ix);
+   di->loctab         = loctab;
+   di->loctab_fndn_ix = loctab_fndn_ix;
+   di->sizeof_fndn_ix = hdr.sizeof_fndn_ix;
+   di->loctab_used    = di->loctab_size = hdr.n_loc;
+
+   if (di->inltab) ML_(dinfo_free)(di->inltab);
+   di->inltab        = inltab;
+   di->inltab_used   = di->inltab_size = hdr.n_inl;
+   di->maxinl_codesz = hdr.maxinl_codesz;
+
+   if (di->cfsi_base) ML_(dinfo_free)(di->cfsi_base);
+   if (di->cfsi_m_ix) ML_(dinfo_free)(di->cfsi_m_ix);
+   if (di->cfsi_rd)   ML_(dinfo_free)(di->cfsi_rd);
+   di->cfsi_base        = cfsi_base;
+   di->cfsi_m_ix        = cfsi_m_ix;
+   di->sizeof_cfsi_m_ix = hdr.sizeof_cfsi_m_ix;
+   di->cfsi_rd          = NULL;
+   di->cfsi_used        = di->cfsi_size = hdr.n_cfsi;
+   di->cfsi_minavma     = hdr.cfsi_minavma + delta;
+   di->cfsi_maxavma     = hdr.cfsi_maxavma + delta;
+
+   if (di->cfsi_exprs) VG_(deleteXA)(di->cfsi_exprs);
+   di->cfsi_exprs = NULL;
+   if (hdr.n_expr > 0) {
+      di->cfsi_exprs = VG_(newXA)(ML_(dinfo_zalloc), "di.dicache.exprs",
+                                  ML_(dinfo_free), sizeof(CfiExpr));
+      VG_(hintSizeXA)(di->cfsi_exprs, hdr.n_expr);
+      for (i = 0; i < hdr.n_expr; i++)
+         VG_(addToXA)(di->cfsi_exprs, &exprs[i]);
+   }
+
+   /* As ML_(canonicaliseTables) does for a DebugInfo not deferred. */
+   if (di->cfsi_m_pool)
+      VG_(freezeDedupPA)(di->cfsi_m_pool, ML_(dinfo_shrink_block));
+   if (di->strpool)
+      VG_(freezeDedupPA)(di->strpool, ML_(dinfo_shrink_block));
+   if (di->fndnpool)
+      VG_(freezeDedupPA)(di->fndnpool, ML_(dinfo_shrink_block));
+
+   if (VG_(clo_verbosity) > 1)
+      VG_(message)(Vg_DebugMsg, "Read cached debug info of %s from %s\n",
+                   di->fsm.filename, name);
+
+   ML_(dinfo_free)(strB);
+   ML_(dinfo_free)(strs);
+   if (secnames) ML_(dinfo_free)(secnames);
+   if (fndns)    ML_(dinfo_free)(fndns);
+   if (cfsi_m)   ML_(dinfo_free)(cfsi_m);
+   if (exprs)    ML_(dinfo_free)(exprs);
+   ML_(dinfo_free)(name);
+   return True;
+
+  fail:
+   /* Strings or pool entries added above are harmless: the pools only
+      grow, and the tables never refer to the extra entries. */
+   if (VG_(clo_verbosity) > 1)
+      VG_(message)(Vg_DebugMsg, "Ignoring invalid debuginfo cache file %s\n",
+                   name);
+   if (strB)           ML_(dinfo_free)(strB);
+   if (strs)           ML_(dinfo_free)(strs);
+   if (symtab)         free_symtab(symtab, n_sym_done);
+   if (secnames)       ML_(dinfo_free)(secnames);
+   if (fndns)          ML_(dinfo_free)(fndns);
+   if (loctab)         ML_(dinfo_free)(loctab);
+   if (loctab_fndn_ix) ML_(dinfo_free)(loctab_fndn_ix);
+   if (inltab)         ML_(dinfo_free)(inltab);
+   if (cfsi_base)      ML_(dinfo_free)(cfsi_base);
+   if (cfsi_m_ix)      ML_(dinfo_free)(cfsi_m_ix);
+   if (cfsi_m)         ML_(dinfo_free)(cfsi_m);
+   if (exprs)          ML_(dinfo_free)(exprs);
+   ML_(dinfo_free)(name);
+   return False;
+}
+
+
+/*------------------------------------------------------------*/
+/*--- Saving                                               ---*/
+/*------------------------------------------------------------*/
+
+typedef
+   struct {
+      WordFM* str_nos;  /* string -> its number */
+      UWord   n_str;    /* number of strings in str_nos */
+      XArray* strB;     /* of HChar: the strings, NUL-terminated */
+   }
+   StrTab;
+
+static UWord str_no ( StrTab* st, const HChar* str )
+{
+   UWord no;
+
+   if (str == NULL)
+      return NO_STR;
+   if (!VG_(lookupFM)(st->str_nos, NULL, &no, (UWord)str)) {
+      no = st->n_str++;
+      VG_(addToFM)(st->str_nos, (UWord)str, no);
+      VG_(addBytesToXA)(st->strB, str, VG_(strlen)(str) + 1);
+   }
+   return no;
+}
+
+void ML_(dicache_save) ( DebugInfo* di )
+{
+   static Bool warned = False;
+   HChar*    name;
+   HChar*    tmpname;
+   SysRes    fd;
+   CacheHdr  hdr;
+   StrTab    st;
+   DiSym*    symtab;
+   XArray*   secnames;
+   UWord*    fndns = NULL;
+   DiInlLoc* inltab = NULL;
+   DiCfSI_m* cfsi_m = NULL;
+   UWord     i, j;
+   Bool      ok;
+
+   name = cache_file_name(di);
+   if (name == NULL)
+      return;
+   VG_(memset)(&hdr, 0, sizeof(hdr));
+
+   /* Number the strings, the way they appear in the file. */
+   st.str_nos = VG_(newFM)(ML_(dinfo_zalloc), "di.dicache.str_nos",
+                           ML_(dinfo_free), NULL);
+   st.n_str   = 0;
+   st.strB    = VG_(newXA)(ML_(dinfo_zalloc), "di.dicache.strB",
+                           ML_(dinfo_free), sizeof(HChar));
+   secnames   = VG_(newXA)(ML_(dinfo_zalloc), "di.dicache.secnames",
+                           ML_(dinfo_free), sizeof(UWord));
+   symtab = di->symtab_used == 0 ? NULL
+            : ML_(dinfo_memdup)("di.dicache.sym", di->symtab,
+                                di->symtab_used * sizeof(DiSym));
+   for (i = 0; i < di->symtab_used; i++) {
+      symtab[i].pri_name = (const HChar*)str_no(&st, symtab[i].pri_name);
+      if (symtab[i].sec_names) {
+         UWord first = VG_(sizeXA)(secnames) + 1;
+         UWord no;
+         for (j = 0; symtab[i].sec_names[j]; j++) {
+            no = str_no(&st, symtab[i].sec_names[j]);
+            VG_(addToXA)(secnames, &no);
+         }
+         no = NO_STR;
+         VG_(addToXA)(secnames, &no);
+         symtab[i].sec_names = (const HChar**)first;
+      }
+   }
+   hdr.n_fndn = di->fndnpool ? VG_(sizeDedupPA)(di->fndnpool) : 0;
+   if (hdr.n_fndn > 0)
+      fndns = ML_(dinfo_zalloc)("di.dicache.fndn",
+                                hdr.n_fndn * 2 * sizeof(UWord));
+   for (i = 0; i < hdr.n_fndn; i++) {
+      const FnDn* fndn = VG_(indexEltNumber)(di->fndnpool, i + 1);
+      fndns[2 * i]     = str_no(&st, fndn->filename);
+      fndns[2 * i + 1] = str_no(&st, fndn->dirname);
+   }
+   if (di->inltab_used > 0)
+      inltab = ML_(dinfo_memdup)("di.dicache.inl", di->inltab,
+                                 di->inltab_used * sizeof(DiInlLoc));
+   for (i = 0; i < di->inltab_used; i++)
+      inltab[i].inlinedfn = (const HChar*)str_no(&st, inltab[i].inlinedfn);
+   hdr.n_cfsi_m = di->cfsi_m_pool ? VG_(sizeDedupPA)(di->cfsi_m_pool) : 0;
+   if (hdr.n_cfsi_m > 0)
+      cfsi_m = ML_(dinfo_zalloc)("di.dicache.cfsi_m",
+                                 hdr.n_cfsi_m * sizeof(DiCfSI_m));
+   for (i = 0; i < hdr.n_cfsi_m; i++)
+      cfsi_m[i] = *(DiCfSI_m*)VG_(indexEltNumber)(di->cfsi_m_pool, i + 1);
+
+   VG_(memcpy)(hdr.magic, DICACHE_MAGIC, sizeof(hdr.magic));
+   hdr.szB_sym          = sizeof(DiSym);
+   hdr.szB_loc          = sizeof(DiLoc);
+   hdr.szB_inl          = sizeof(DiInlLoc);
+   hdr.szB_cfsi_m       = sizeof(DiCfSI_m);
+   hdr.szB_expr         = sizeof(CfiExpr);
+   hdr.read_inline_info = VG_(clo_read_inline_info);
+   hdr.text_avma        = di->text_avma;
+   hdr.text_size        = di->text_size;
+   get_sects(di, hdr.present, hdr.bias);
+   hdr.n_str            = st.n_str;
+   hdr.strB             = VG_(sizeXA)(st.strB);
+   hdr.n_sym            = di->symtab_used;
+   hdr.n_secname        = VG_(sizeXA)(secnames);
+   hdr.n_loc            = di->loctab_used;
+   hdr.sizeof_fndn_ix   = di->sizeof_fndn_ix;
+   hdr.n_inl            = di->inltab_used;
+   hdr.maxinl_codesz    = di->maxinl_codesz;
+   hdr.n_cfsi           = di->cfsi_used;
+   hdr.sizeof_cfsi_m_ix = di->sizeof_cfsi_m_ix;
+   hdr.n_expr           = di->cfsi_exprs ? VG_(sizeXA)(di->cfsi_exprs) : 0;
+   hdr.cfsi_minavma     = di->cfsi_minavma;
+   hdr.cfsi_maxavma     = di->cfsi_maxavma;
+   if (hdr.sizeof_fndn_ix == 0)
+      hdr.sizeof_fndn_ix = 1;
+
+   /* Write under a name of our own, then rename, so that concurrent
+      readers and writers never see a partial file. */
+   tmpname = ML_(dinfo_zalloc)("di.dicache.tmpname",
+                               VG_(strlen)(name) + 32);
+   VG_(sprintf)(tmpname, "%s.%d.tmp", name, VG_(getpid)());
+   fd = VG_(open)(tmpname, VKI_O_CREAT | VKI_O_WRONLY | VKI_O_TRUNC,
+                  VKI_S_IRUSR | VKI_S_IWUSR | VKI_S_IRGRP | VKI_S_IROTH);
+   ok = !sr_isError(fd);
+   if (ok) {
+#     define WRITE(_p, _szB) \
+         ok = ok && ((_szB) == 0 || write_all(sr_Res(fd), (_p), (_szB)))
+      WRITE(&hdr, sizeof(hdr));
+      WRITE(VG_(sizeXA)(st.strB) ? VG_(indexXA)(st.strB, 0) : NULL,
+            hdr.strB);
+      WRITE(symtab, hdr.n_sym * sizeof(DiSym));
+      WRITE(hdr.n_secname ? VG_(indexXA)(secnames, 0) : NULL,
+            hdr.n_secname * sizeof(UWord));
+      WRITE(fndns, hdr.n_fndn * 2 * sizeof(UWord));
+      WRITE(di->loctab, hdr.n_loc * sizeof(DiLoc));
+      WRITE(di->loctab_fndn_ix, hdr.n_loc * hdr.sizeof_fndn_ix);
+      WRITE(inltab, hdr.n_inl * sizeof(DiInlLoc));
+      WRITE(di->cfsi_base, hdr.n_cfsi * sizeof(Addr));
+      WRITE(di->cfsi_m_ix, hdr.n_cfsi * hdr.sizeof_cfsi_m_ix);
+      WRITE(cfsi_m, hdr.n_cfsi_m * sizeof(DiCfSI_m));
+      WRITE(hdr.n_expr ? VG_(indexXA)(di->cfsi_exprs, 0) : NULL,
+            hdr.n_expr * sizeof(CfiExpr));
+#     undef WRITE
+      VG_(close)(sr_Res(fd));
+      ok = ok && VG_(rename)(tmpname, name) == 0;
+      if (!ok)
+         VG_(unlink)(tmpname);
+   }
+   if (!ok && !warned) {
+      warned = True;
+      VG_(message)(Vg_UserMsg,
+                   "warning: cannot write debuginfo cache file %s\n", name);
+   } else if (ok && VG_(clo_verbosity) > 1) {
+      VG_(message)(Vg_DebugMsg, "Saved debug info of %s in %s\n",
+                   di->fsm.filename, name);
+   }
+
+   VG_(deleteFM)(st.str_nos, NULL, NULL);
+   VG_(deleteXA)(st.strB);
+   VG_(deleteXA)(secnames);
+   if (symtab) ML_(dinfo_free)(symtab);
+   if (fndns)  ML_(dinfo_free)(fndns);
+   if (inltab) ML_(dinfo_free)(inltab);
+   if (cfsi_m) ML_(dinfo_free)(cfsi_m);
+   ML_(dinfo_free)(tmpname);
+   ML_(dinfo_free)(name);
+}
+
+#endif // defined(VGO_linux) || defined(VGO_solaris) || defined(VGO_freebsd)
+
+/*--------------------------------------------------------------------*/
+/*--- end                                               dicache.c ---*/
+/*--------------------------------------------------------------------*/
@@ -1121,6 +1121,28 @@ DiOffT ML_(img_real_size)(const DiImage* img)
    return img->real_size;
 }
 
+void ML_(img_prefetch)(const DiImage* img, DiOffT offset, SizeT size)
+{
+   /* Linux reads at most its readahead window (often 128KB) per hint,
+      so ask for the data a chunk at a time. */
+   const SizeT chunk = 128 * 1024;
+   DiOffT end;
+
+   vg_assert(img != NULL);
+   if (!img->source.is_local || size == 0 || offset >= img->real_size)
+      return;
+   if (size > img->real_size - offset)
+      size = img->real_size - offset;
+   end = offset + size;
+   /* The kernel reads the data in the background; whether it manages
+      to or not makes no difference to us. */
+   for (; offset < end; offset += chunk) {
+      SizeT len = end - offset < chunk ? end - offset : chunk;
+      if (sr_isError(VG_(fadvise_willneed)(img->source.fd, offset, len)))
+         break;
+   }
+}
+
 inline Bool ML_(img_valid)(const DiImage* img, DiOffT offset, SizeT size)
 {
    vg_assert(img != NULL);
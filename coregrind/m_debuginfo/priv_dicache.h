@@ -0,0 +1,51 @@
+
+/*--------------------------------------------------------------------*/
+/*--- On-disk cache of debug info tables.          priv_dicache.h ---*/
+/*--------------------------------------------------------------------*/
+
+/*
+   This file is part of Valgrind, a dynamic binary instrumentation
+   framework.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+   The GNU General Public License is contained in the file COPYING.
+*/
+
+#ifndef __PRIV_DICACHE_H
+#define __PRIV_DICACHE_H
+
+#include "pub_core_basics.h"     // Bool
+#include "pub_core_debuginfo.h"  // DebugInfo
+
+/* With --debuginfo-cache=<dir>, the tables of an ELF object are saved,
+   once its debug info has been read and canonicalised, in a file of
+   <dir> named after the object's build-id.  Later runs load them from
+   there instead of reading the debug info again.
+
+   ML_(dicache_load) is called instead of ML_(read_elf_debug) for a
+   deferred DebugInfo.  It returns True if it loaded the tables of DI,
+   which are then ready for use.  It returns False, leaving DI's tables
+   usable by ML_(read_elf_debug), if the cache is disabled or holds
+   nothing suitable for DI. */
+extern Bool ML_(dicache_load) ( DebugInfo* di );
+
+/* Saves the canonicalised tables of DI in the cache, if enabled. */
+extern void ML_(dicache_save) ( DebugInfo* di );
+
+#endif /* ndef __PRIV_DICACHE_H */
+
+/*--------------------------------------------------------------------*/
+/*--- end                                          priv_dicache.h ---*/
+/*--------------------------------------------------------------------*/
@@ -83,6 +83,11 @@ DiOffT ML_(img_size)(const DiImage* img);
 /* Real size of the image. */
 DiOffT ML_(img_real_size)(const DiImage* img);
 
+/* Ask for the real (not decompressed) bytes [offset, +size) of the
+   image to be read in ahead of their use.  Only does anything for local
+   files, on platforms supporting VG_(fadvise_willneed). */
+void ML_(img_prefetch)(const DiImage* img, DiOffT offset, SizeT size);
+
 /* Does the section [offset, +size) exist in the image? */
 Bool ML_(img_valid)(const DiImage* img, DiOffT offset, SizeT size);
 
@@ -62,6 +62,10 @@ extern Bool ML_(read_elf_object) ( DebugInfo* di );
    function.  */
 extern Bool ML_(read_elf_debug) ( DebugInfo* di );
 
+/* Returns the build-id of the ELF object in FILENAME, as a string of hex
+   digits in ML_(dinfo_zalloc)'d space, or NULL if it has none. */
+extern HChar* ML_(find_elf_buildid) ( const HChar* filename );
+
 extern Bool ML_(check_elf_and_get_rw_loads) ( Int fd, const HChar* filename, Int * rw_load_count );
 
 
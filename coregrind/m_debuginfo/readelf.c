@@ -1952,6 +1952,10 @@ Bool ML_(read_elf_object) ( struct _DebugInfo* di )
 
    XArray* /* of RangeAndBias */ svma_ranges = NULL;
 
+   /* Extent of the DWARF sections in the main file, if any. */
+   DiOffT   debug_mioff_lo = DiOffT_INVALID;
+   DiOffT   debug_mioff_hi = 0;
+
 #  if defined(SOLARIS_PT_SUNDWTRACE_THRP)
    Addr dtrace_data_vaddr = 0;
 #  endif
@@ -2379,6 +2383,16 @@ Bool ML_(read_elf_object) ( struct _DebugInfo* di )
          continue;
       }
 
+      /* Note where the DWARF sections are.  They are only read by
+         ML_(read_elf_debug), when VG_(di_load_di) is first needed. */
+      if (!nobits && (VG_(strncmp)(name, ".debug_", 7) == 0
+                      || VG_(strncmp)(name, ".zdebug_", 8) == 0)) {
+         if (foff < debug_mioff_lo)
+            debug_mioff_lo = foff;
+         if (foff + size > debug_mioff_hi)
+            debug_mioff_hi = foff + size;
+      }
+
 #     define BAD(_secname)                                 \
          do { ML_(symerr)(di, True,                        \
                           "Can't make sense of " _secname  \
@@ -2842,6 +2856,14 @@ Bool ML_(read_elf_object) ( struct _DebugInfo* di )
 
    } /* iterate over the section headers */
 
+   /* TOPLEVEL */
+   /* Have the kernel start reading the DWARF sections in now, while the
+      client runs, so that the first stack trace or error report, which
+      needs them, does not wait for the disk. */
+   if (VG_(clo_prefetch_debuginfo) && debug_mioff_hi > 0)
+      ML_(img_prefetch)(mimg, debug_mioff_lo,
+                        debug_mioff_hi - debug_mioff_lo);
+
    /* TOPLEVEL */
    if (0) VG_(printf)("YYYY text_: avma %#lx  size %lu  bias %#lx\n",
                       di->text_avma, di->text_size, (UWord)di->text_bias);
@@ -3852,6 +3874,19 @@ Bool ML_(read_elf_debug) ( struct _DebugInfo* di )
    /* NOTREACHED */
 }
 
+HChar* ML_(find_elf_buildid) ( const HChar* filename )
+{
+   HChar*   buildid = NULL;
+   DiImage* mimg    = ML_(img_from_local_file)(filename);
+
+   if (mimg == NULL)
+      return NULL;
+   if (is_elf_object_file_by_DiImage(mimg, False))
+      buildid = find_buildid(mimg, False, False);
+   ML_(img_done)(mimg);
+   return buildid;
+}
+
 Bool ML_(check_elf_and_get_rw_loads) ( Int fd, const HChar* filename, Int * rw_load_count )
 {
    Bool     res, ok;
@@ -725,16 +725,38 @@ void* VG_(memcpy) ( void *dest, const void *src, SizeT sz )
 void* VG_(memmove)(void *dest, const void *src, SizeT sz)
 {
    SizeT i;
+   const Addr d = (Addr)dest;
+   const Addr s = (Addr)src;
+   const Bool words = VG_IS_WORD_ALIGNED(d) && VG_IS_WORD_ALIGNED(s);
+
    if (sz == 0)
       return dest;
-   if (dest < src) {
-      for (i = 0; i < sz; i++) {
+   if (d + sz <= s || s + sz <= d)
+      return VG_(memcpy)(dest, src, sz);
+
+   /* Overlapping.  If both are word aligned, they are at least a word
+      apart, so whole words can be copied in the right direction. */
+   if (d < s) {
+      i = 0;
+      if (words) {
+         for (; i + sizeof(UWord) <= sz; i += sizeof(UWord))
+            *(UWord*)(d + i) = *(const UWord*)(s + i);
+      }
+      for (; i < sz; i++) {
          ((UChar*)dest)[i] = ((const UChar*)src)[i];
       }
    }
-   else if (dest > src) {
-      for (i = 0; i < sz; i++) {
-         ((UChar*)dest)[sz-i-1] = ((const UChar*)src)[sz-i-1];
+   else if (d > s) {
+      i = sz;
+      if (words) {
+         for (; i % sizeof(UWord) != 0; i--)
+            ((UChar*)dest)[i-1] = ((const UChar*)src)[i-1];
+         for (; i >= sizeof(UWord); i -= sizeof(UWord))
+            *(UWord*)(d + i - sizeof(UWord))
+               = *(const UWord*)(s + i - sizeof(UWord));
+      }
+      for (; i > 0; i--) {
+         ((UChar*)dest)[i-1] = ((const UChar*)src)[i-1];
       }
    }
    return dest;
@@ -1174,6 +1174,23 @@ SysRes VG_(pread) ( Int fd, void* buf, Int count, OffT offset )
 #  endif
 }
 
+SysRes VG_(fadvise_willneed) ( Int fd, OffT offset, OffT len )
+{
+   SysRes res;
+   /* On 32 bit platforms, the 64 bit offset and length are split in
+      platform-specific ways; not worth it for a hint. */
+#  if defined(VGO_linux) && VG_WORDSIZE == 8
+   res = VG_(do_syscall4)(__NR_fadvise64, fd, offset, len,
+                          VKI_POSIX_FADV_WILLNEED);
+#  elif defined(VGO_freebsd) && VG_WORDSIZE == 8
+   res = VG_(do_syscall4)(__NR_posix_fadvise, fd, offset, len,
+                          VKI_POSIX_FADV_WILLNEED);
+#  else
+   res = VG_(mk_SysRes_Error)(VKI_ENOSYS);
+#  endif
+   return res;
+}
+
 /* Return the name of a directory for temporary files. */
 const HChar *VG_(tmpdir)(void)
 {
@@ -1003,7 +1003,7 @@ Int VG_(fork) ( void )
    Timing stuff
    ------------------------------------------------------------------ */
 
-UInt VG_(read_millisecond_timer) ( void )
+ULong VG_(read_microsecond_timer) ( void )
 {
    /* 'now' and 'base' are in microseconds */
    static ULong base = 0;
@@ -1053,7 +1053,12 @@ UInt VG_(read_millisecond_timer) ( void )
    if (base == 0)
       base = now;
 
-   return (now - base) / 1000;
+   return now - base;
+}
+
+UInt VG_(read_millisecond_timer) ( void )
+{
+   return (UInt)(VG_(read_microsecond_timer)() / 1000);
 }
 
 #  if defined(VGO_linux) || defined(VGO_solaris) || defined(VGO_freebsd)
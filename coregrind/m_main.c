@@ -187,6 +187,8 @@ static void usage_NORETURN ( int need_help )
 "    --allow-mismatched-debuginfo=no|yes  [no]\n"
 "                              for the above two flags only, accept debuginfo\n"
 "                              objects that don't \"match\" the main object\n"
+"    --debuginfo-cache=<dir>   keep the debug info read from objects with a\n"
+"                              build-id in <dir>, and reuse it next time\n"
 "    --smc-check=none|stack|all|all-non-file [all-non-file]\n"
 "                              checks for self-modifying code: none, only for\n"
 "                              code found in stacks, for all code, or for all\n"
@@ -200,6 +202,8 @@ static void usage_NORETURN ( int need_help )
 "                              and use it to print better error messages in\n"
 "                              tools that make use of it (Memcheck, Helgrind,\n"
 "                              DRD) [no]\n"
+"    --prefetch-debuginfo=yes|no  start reading the debug info of objects\n"
+"                              from disk as soon as they are mapped [yes]\n"
 "    --vgdb-poll=<number>      gdbserver poll max every <number> basic blocks [%d] \n"
 "    --vgdb-shadow-registers=no|yes   let gdb see the shadow registers [no]\n"
 "    --vgdb-prefix=<prefix>    prefix for vgdb FIFOs [%s]\n"
@@ -222,6 +226,10 @@ static void usage_NORETURN ( int need_help )
 "           program counters in max <number> frames) [0]\n"
 "    --num-transtab-sectors=<number> size of translated code cache [%d]\n"
 "           more sectors may increase performance, but use more memory.\n"
+"    --max-transtab-sectors=<number> let the translated code cache grow\n"
+"           to this many sectors if it is too small [0, meaning no growth]\n"
+"    --tier-up-threshold=<number> retranslate blocks executed <number>\n"
+"           times with more optimisation [0, meaning never]\n"
 "    --avg-transtab-entry-size=<number> avg size in bytes of a translated\n"
 "           basic block [0, meaning use tool provided default]\n"
 "    --aspace-minaddr=0xPP     avoid mapping memory below 0xPP [guessed]\n"
@@ -697,6 +705,8 @@ static void process_option (Clo_Mode mode,
                         VG_(clo_progress_interval), 3600) {}
    else if VG_BOOL_CLO(arg, "--read-inline-info", VG_(clo_read_inline_info)) {}
    else if VG_BOOL_CLO(arg, "--read-var-info",    VG_(clo_read_var_info)) {}
+   else if VG_BOOL_CLO(arg, "--prefetch-debuginfo",
+                       VG_(clo_prefetch_debuginfo)) {}
 
    else if VG_INT_CLO (arg, "--dump-error",       VG_(clo_dump_error))   {}
    else if VG_INT_CLO (arg, "--input-fd",         VG_(clo_input_fd))     {}
@@ -706,6 +716,12 @@ static void process_option (Clo_Mode mode,
    else if VG_BINT_CLO(arg, "--num-transtab-sectors",
                        VG_(clo_num_transtab_sectors),
                        MIN_N_SECTORS, MAX_N_SECTORS) {}
+   else if VG_BINT_CLO(arg, "--max-transtab-sectors",
+                       VG_(clo_max_transtab_sectors),
+                       0, MAX_N_SECTORS) {}
+   else if VG_BINT_CLO(arg, "--tier-up-threshold",
+                       VG_(clo_tier_up_threshold),
+                       0, 1000000000) {}
    else if VG_BINT_CLO(arg, "--avg-transtab-entry-size",
                        VG_(clo_avg_transtab_entry_size),
                        50, 5000) {}
@@ -797,6 +813,9 @@ static void process_option (Clo_Mode mode,
    else if VG_STR_CLO(arg, "--debuginfo-server",
                       VG_(clo_debuginfo_server)) {}
 
+   else if VG_STR_CLO(arg, "--debuginfo-cache",
+                      VG_(clo_debuginfo_cache)) {}
+
    else if VG_BOOL_CLO(arg, "--allow-mismatched-debuginfo",
                        VG_(clo_allow_mismatched_debuginfo)) {}
 
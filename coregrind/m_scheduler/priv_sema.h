@@ -36,6 +36,10 @@ typedef struct {
    Int  pipe[2];
    Int  owner_lwpid;  /* who currently has it */
    Bool held_as_LL;   /* if held, True == held by a _LL call */
+   /* Number of threads holding or waiting for the token.  Where
+      atomic builtins are available, the token only goes through the
+      pipe when this shows contention. */
+   volatile Int n_wanting;
 } vg_sema_t;
 
 // Nb: this may be OS-specific, but let's not factor it out until we
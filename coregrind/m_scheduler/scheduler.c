@@ -145,6 +145,17 @@ static ULong stats__n_xIndir_misses = 0;
 /*global*/ UInt VG_(stats__n_xIndir_hits3_32) = 0;
 /*global*/ UInt VG_(stats__n_xIndir_misses_32) = 0;
 
+/* Stats: translations requested because a chain-me point was reached
+   (the target is a static branch target, known when the jumping block
+   was translated) and because of a fast-cache miss.  Also, the number
+   of translations done while other threads were alive, and so were
+   kept waiting for the big lock, and how long those took in total.  The
+   latter is only measured with --stats=yes. */
+static ULong stats__n_chain_me_translations = 0;
+static ULong stats__n_tt_miss_translations = 0;
+static ULong stats__n_stalling_translations = 0;
+static ULong stats__usecs_stalling_translations = 0;
+
 /* Sanity checking counts. */
 static UInt sanity_fast_count = 0;
 static UInt sanity_slow_count = 0;
@@ -175,6 +186,17 @@ void VG_(print_scheduler_stats)(void)
    VG_(message)(Vg_DebugMsg,
       "scheduler: %'llu/%'llu major/minor sched events.\n",
       n_scheduling_events_MAJOR, n_scheduling_events_MINOR);
+   VG_(message)(Vg_DebugMsg,
+                "scheduler: %'llu translations at chain-me points, "
+                "%'llu at fast-cache misses\n",
+                stats__n_chain_me_translations,
+                stats__n_tt_miss_translations);
+   if (VG_(clo_stats))
+      VG_(message)(Vg_DebugMsg,
+                   "scheduler: %'llu translations stalled other threads, "
+                   "for %'llu ms in total\n",
+                   stats__n_stalling_translations,
+                   stats__usecs_stalling_translations / 1000);
    VG_(message)(Vg_DebugMsg, 
                 "   sanity: %u cheap, %u expensive checks.\n",
                 sanity_fast_count, sanity_slow_count );
@@ -262,6 +284,25 @@ void maybe_show_sb_profile ( void )
    }
 }
 
+/* For --tier-up-threshold: every so many blocks, redo the translations
+   that got hot. */
+#define TIER_UP_INTERVAL 1000000
+
+static
+void maybe_tier_up ( void )
+{
+   /* DO NOT MAKE NON-STATIC */
+   static ULong bbs_done_lastcheck = 0;
+   /* */
+   vg_assert(VG_(clo_tier_up_threshold) > 0);
+   Long delta = (Long)(bbs_done - bbs_done_lastcheck);
+   vg_assert(delta >= 0);
+   if ((ULong)delta >= TIER_UP_INTERVAL) {
+      bbs_done_lastcheck = bbs_done;
+      VG_(tier_up_hot_translations)(VG_(clo_tier_up_threshold));
+   }
+}
+
 static
 const HChar* name_of_sched_event ( UInt event )
 {
@@ -1134,6 +1175,32 @@ void run_thread_for_a_while ( /*OUT*/HWord* two_words,
    The scheduler proper.
    ------------------------------------------------------------------ */
 
+/* Make a translation for tid's current IP, for handle_tt_miss and
+   handle_chain_me.  Every other thread is kept waiting on the big lock
+   meanwhile, so with --stats=yes note how long that takes when there
+   are other threads. */
+static Bool translate_for_thread ( ThreadId tid, Addr ip )
+{
+   Bool  stalling = False;
+   ULong t_start  = 0;
+   Bool  ok;
+
+   if (VG_(clo_stats) && VG_(count_living_threads)() > 1) {
+      stalling = True;
+      t_start  = VG_(read_microsecond_timer)();
+   }
+
+   ok = VG_(translate)( tid, ip, /*debug*/False, 0/*not verbose*/, 
+                        bbs_done, True/*allow redirection*/ );
+
+   if (stalling) {
+      stats__n_stalling_translations++;
+      stats__usecs_stalling_translations
+         += VG_(read_microsecond_timer)() - t_start;
+   }
+   return ok;
+}
+
 static void handle_tt_miss ( ThreadId tid )
 {
    Bool found;
@@ -1145,8 +1212,8 @@ static void handle_tt_miss ( ThreadId tid )
                                  ip, True/*upd_fast_cache*/ );
    if (UNLIKELY(!found)) {
       /* Not found; we need to request a translation. */
-      if (VG_(translate)( tid, ip, /*debug*/False, 0/*not verbose*/, 
-                          bbs_done, True/*allow redirection*/ )) {
+      stats__n_tt_miss_translations++;
+      if (translate_for_thread( tid, ip )) {
          found = VG_(search_transtab)( NULL, NULL, NULL,
                                        ip, True ); 
          vg_assert2(found, "handle_tt_miss: missing tt_fast entry");
@@ -1173,8 +1240,8 @@ void handle_chain_me ( ThreadId tid, void* place_to_chain, Bool toFastEP )
                                  ip, False/*dont_upd_fast_cache*/ );
    if (!found) {
       /* Not found; we need to request a translation. */
-      if (VG_(translate)( tid, ip, /*debug*/False, 0/*not verbose*/, 
-                          bbs_done, True/*allow redirection*/ )) {
+      stats__n_chain_me_translations++;
+      if (translate_for_thread( tid, ip )) {
          found = VG_(search_transtab)( NULL, &to_sNo, &to_tteNo,
                                        ip, False ); 
          vg_assert2(found, "handle_chain_me: missing tt_fast entry");
@@ -1806,6 +1873,9 @@ VgSchedReturnCode VG_(scheduler) ( ThreadId tid )
 
       if (UNLIKELY(VG_(clo_profyle_sbs)) && VG_(clo_profyle_interval) > 0)
          maybe_show_sb_profile();
+
+      if (UNLIKELY(VG_(clo_tier_up_threshold) > 0))
+         maybe_tier_up();
    }
 
    if (VG_(clo_trace_sched))
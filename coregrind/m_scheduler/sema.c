@@ -26,6 +26,7 @@
    The GNU General Public License is contained in the file COPYING.
 */
 
+#include "config.h"                 // HAVE_BUILTIN_ATOMIC
 #include "pub_core_basics.h"
 #include "pub_core_debuglog.h"
 #include "pub_core_vki.h"
@@ -41,8 +42,22 @@
 /* 
    Slower (than the removed futex-based sema scheme) but more portable
    pipe-based token passing scheme.
+
+   When the compiler provides atomic builtins, the pipe is only used
+   when there is contention: n_wanting counts the threads that hold or
+   want the token, and a thread only reads the pipe if somebody else
+   was counted before it, and only writes it if somebody else was still
+   counted after it.  So a thread taking and dropping an uncontended
+   lock, eg. around a blocking syscall, makes no syscalls to do so.
+   When the lock is contended the behaviour is as before.
  */
 
+#if defined(HAVE_BUILTIN_ATOMIC)
+#  define SEMA_HAS_FAST_PATH 1
+#else
+#  define SEMA_HAS_FAST_PATH 0
+#endif
+
 /* Cycle the char passed through the pipe through 'A' .. 'Z' to make
    it easier to make sense of strace/truss output - makes it possible
    to see more clearly the change of ownership of the lock.  Need to
@@ -68,6 +83,7 @@ void ML_(sema_init)(vg_sema_t *sema)
    vg_assert(sema->pipe[0] != sema->pipe[1]);
 
    sema->owner_lwpid = -1;
+   sema->n_wanting = 0;
 
    /* create initial token */
    sema_char = 'A';
@@ -77,8 +93,12 @@ void ML_(sema_init)(vg_sema_t *sema)
    INNER_REQUEST(ANNOTATE_RWLOCK_CREATE(sema));
    INNER_REQUEST(ANNOTATE_BENIGN_RACE_SIZED(&sema->owner_lwpid,
                                             sizeof(sema->owner_lwpid), ""));
-   res = VG_(write)(sema->pipe[1], buf, 1);
-   vg_assert(res == 1);
+   if (!SEMA_HAS_FAST_PATH) {
+      /* With the fast path, the token is implicitly available while
+         n_wanting is zero, so it must not also be in the pipe. */
+      res = VG_(write)(sema->pipe[1], buf, 1);
+      vg_assert(res == 1);
+   }
 }
 
 void ML_(sema_deinit)(vg_sema_t *sema)
@@ -102,6 +122,16 @@ void ML_(sema_down)( vg_sema_t *sema, Bool as_LL )
    vg_assert(sema->owner_lwpid != lwpid); /* can't have it already */
    vg_assert(sema->pipe[0] != sema->pipe[1]);
 
+#  if SEMA_HAS_FAST_PATH
+   if (__sync_fetch_and_add(&sema->n_wanting, 1) == 0) {
+      /* Nobody else has it or wants it: it is ours. */
+      INNER_REQUEST(ANNOTATE_RWLOCK_ACQUIRED(sema, /*is_w*/1));
+      sema->owner_lwpid = lwpid;
+      sema->held_as_LL = as_LL;
+      return;
+   }
+#  endif
+
   again:
    buf[0] = buf[1] = 0;
    ret = VG_(read)(sema->pipe[0], buf, 1);
@@ -139,6 +169,10 @@ void ML_(sema_up)( vg_sema_t *sema, Bool as_LL )
    sema->owner_lwpid = 0;
 
    INNER_REQUEST(ANNOTATE_RWLOCK_RELEASED(sema, /*is_w*/1));
+#  if SEMA_HAS_FAST_PATH
+   if (__sync_sub_and_fetch(&sema->n_wanting, 1) == 0)
+      return; /* nobody is waiting for the token */
+#  endif
    ret = VG_(write)(sema->pipe[1], buf, 1);
 
    if (ret != 1) 
@@ -37,6 +37,7 @@
 #include "pub_core_libcbase.h"
 #include "pub_core_libcassert.h"
 #include "pub_core_libcprint.h"
+#include "pub_core_libcproc.h"   // VG_(read_microsecond_timer)
 #include "pub_core_options.h"
 
 #include "pub_core_debuginfo.h"  // VG_(get_fnname_w_offset)
@@ -69,6 +70,16 @@ static ULong n_TRACE_total_guest_insns              = 0;
 static ULong n_TRACE_total_uncond_branches_followed = 0;
 static ULong n_TRACE_total_cond_branches_followed   = 0;
 
+/* How many traces were made from code in file-backed segments.  Such
+   code is the same from one run to the next, so this gives an upper
+   bound on the translation work that could in principle be reused
+   across runs. */
+static ULong n_TRACE_from_file_segs                 = 0;
+
+/* Wallclock time spent in LibVEX_Translate.  Only measured with
+   --stats=yes, since reading the timer costs a syscall. */
+static ULong n_TRACE_total_usecs                    = 0;
+
 static ULong n_SP_updates_new_fast            = 0;
 static ULong n_SP_updates_new_generic_known   = 0;
 static ULong n_SP_updates_die_fast            = 0;
@@ -89,6 +100,18 @@ void VG_(print_translation_stats) ( void )
        n_TRACE_total_guest_insns, n_TRACE_total_constructed,
        n_TRACE_total_uncond_branches_followed,
        n_TRACE_total_cond_branches_followed);
+   VG_(message)
+      (Vg_DebugMsg,
+       "translate: %'llu traces from file-backed code, %'llu from other code\n",
+       n_TRACE_from_file_segs,
+       n_TRACE_total_constructed - n_TRACE_from_file_segs);
+   if (VG_(clo_stats) && n_TRACE_total_constructed > 0)
+      VG_(message)
+         (Vg_DebugMsg,
+          "translate: %'llu ms spent in LibVEX_Translate, "
+          "avg %'llu us per trace\n",
+          n_TRACE_total_usecs / 1000,
+          n_TRACE_total_usecs / n_TRACE_total_constructed);
    UInt n_SP_updates = n_SP_updates_new_fast + n_SP_updates_new_generic_known
                      + n_SP_updates_die_fast + n_SP_updates_die_generic_known
                      + n_SP_updates_generic_unknown;
@@ -756,6 +779,28 @@ IRSB* vg_SP_update_pass ( void*             closureV,
 static UChar tmpbuf[N_TMPBUF];
 
 
+/* The optimiser settings for hot translations (see
+   --tier-up-threshold): the user's settings, but with the longest
+   allowed superblocks, more loop unrolling, full IR optimisation, and
+   the slower but better register allocator. */
+static const VexControl* get_hot_vex_control ( void )
+{
+   static VexControl hot_vex_control;
+   static Bool       hot_vex_control_done = False;
+
+   if (!hot_vex_control_done) {
+      hot_vex_control = VG_(clo_vex_control);
+      hot_vex_control.iropt_level     = 2;
+      hot_vex_control.guest_max_insns = 100;
+      hot_vex_control.iropt_unroll_thresh
+         = VG_MIN(400, 2 * VG_(clo_vex_control).iropt_unroll_thresh);
+      hot_vex_control.regalloc_version = 2;
+      hot_vex_control_done = True;
+   }
+   return &hot_vex_control;
+}
+
+
 /* Function pointers we must supply to LibVEX in order that it
    can bomb out and emit messages under Valgrind's control. */
 __attribute__ ((noreturn))
@@ -1515,6 +1560,7 @@ Bool VG_(translate) ( ThreadId tid,
    VexTranslateArgs   vta;
    VexTranslateResult tres;
    VgCallbackClosure  closure;
+   Bool               is_hot;
 
    /* Make sure Vex is initialised right. */
 
@@ -1802,7 +1848,17 @@ Bool VG_(translate) ( ThreadId tid,
    vta.preamble_function = preamble_fn;
    vta.traceflags        = verbosity;
    vta.sigill_diag       = VG_(clo_sigill_diag);
-   vta.addProfInc        = VG_(clo_profyle_sbs) && kind != T_NoRedir;
+   /* With --tier-up-threshold, translations are first made with the
+      normal settings and a profile counter.  Once a translation has
+      run often enough, the scheduler discards it and it gets redone
+      here as a hot translation, using the settings of
+      hot_vex_control, and without a counter unless profiling. */
+   is_hot = VG_(clo_tier_up_threshold) > 0 && kind != T_NoRedir
+            && VG_(is_hot_guest_addr)(nraddr);
+   vta.addProfInc        = kind != T_NoRedir
+                           && (VG_(clo_profyle_sbs)
+                               || (VG_(clo_tier_up_threshold) > 0
+                                   && !is_hot));
 
    /* Set up the dispatch continuation-point info.  If this is a
       no-redir translation then it cannot be chained, and the chain-me
@@ -1833,7 +1889,16 @@ Bool VG_(translate) ( ThreadId tid,
       = VG_(fnptr_to_fnentry)( &VG_(disp_cp_xassisted) );
 
    /* Sheesh.  Finally, actually _do_ the translation! */
-   tres = LibVEX_Translate ( &vta );
+   ULong t_start = VG_(clo_stats) ? VG_(read_microsecond_timer)() : 0;
+   if (is_hot) {
+      LibVEX_Update_Control( get_hot_vex_control() );
+      tres = LibVEX_Translate ( &vta );
+      LibVEX_Update_Control( &VG_(clo_vex_control) );
+   } else {
+      tres = LibVEX_Translate ( &vta );
+   }
+   if (VG_(clo_stats))
+      n_TRACE_total_usecs += VG_(read_microsecond_timer)() - t_start;
 
    vg_assert(tres.status == VexTransOK);
    vg_assert(tres.n_sc_extents <= 3);
@@ -1844,6 +1909,8 @@ Bool VG_(translate) ( ThreadId tid,
    n_TRACE_total_guest_insns += tres.n_guest_instrs;
    n_TRACE_total_uncond_branches_followed += tres.n_uncond_in_trace;
    n_TRACE_total_cond_branches_followed   += tres.n_cond_in_trace;
+   if (seg->kind == SkFileC)
+      n_TRACE_from_file_segs += 1;
    } /* END new scope specially for 'seg' */
 
    /* Tell aspacem of all segments that have had translations taken
@@ -1875,7 +1942,8 @@ Bool VG_(translate) ( ThreadId tid,
                                 tmpbuf_used,
                                 tres.n_sc_extents > 0,
                                 tres.offs_profInc,
-                                tres.n_guest_instrs );
+                                tres.n_guest_instrs,
+                                is_hot );
       } else {
           vg_assert(tres.offs_profInc == -1); /* -1 == unset */
           VG_(add_to_unredir_transtab)( &vge,
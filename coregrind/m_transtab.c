@@ -54,9 +54,21 @@
 /* Nr of sectors provided via command line parameter. */
 UInt VG_(clo_num_transtab_sectors) = N_SECTORS_DEFAULT;
 /* Nr of sectors.
-   Will be set by VG_(init_tt_tc) to VG_(clo_num_transtab_sectors). */
+   Will be set by VG_(init_tt_tc) to VG_(clo_num_transtab_sectors), and
+   can later grow up to max_n_sectors. */
 static SECno n_sectors = 0;
 
+/* Nr of sectors the cache may grow to, provided via command line
+   parameter.  Values <= VG_(clo_num_transtab_sectors) mean the number
+   of sectors never changes. */
+UInt VG_(clo_max_transtab_sectors) = 0;
+/* Will be set by VG_(init_tt_tc). */
+static SECno max_n_sectors = 0;
+
+/* Number of executions after which a translation is redone with more
+   optimisation, provided via command line parameter.  0 means never. */
+UInt VG_(clo_tier_up_threshold) = 0;
+
 /* Average size of a transtab code entry. 0 means to use the tool
    provided default. */
 UInt VG_(clo_avg_transtab_entry_size) = 0;
@@ -174,6 +186,11 @@ typedef
                are profiling. */
             ULong    count;
             UShort   weight;
+            /* True if this translation was made because an earlier
+               translation of the same code got hot, with
+               --tier-up-threshold.  Hot translations are never tiered
+               up again. */
+            Bool     hot;
          } prof; // if status == InUse
          TTEno next_empty_tte; // if status != InUse
       } usage;
@@ -517,6 +534,21 @@ static ULong n_sectors_recycled = 0;
 static ULong n_disc_count = 0;
 static ULong n_disc_osize = 0;
 
+/* Number of translations made of code whose previous translation was
+   recently dumped, and number of sectors added because of that. */
+static ULong n_dump_retranslated = 0;
+static ULong n_sectors_added = 0;
+
+/* Number of translations discarded because they got hot, and number
+   of hot translations made. */
+static ULong n_tiered_up = 0;
+static ULong n_in_hot_count = 0;
+
+/* The same, but only since youngest_sector last wrapped round.  Used
+   to decide whether to add a sector. */
+static ULong cycle_n_in_count = 0;
+static ULong cycle_n_dump_retranslated = 0;
+
 
 /*-------------------------------------------------------------*/
 /*--- Misc                                                  ---*/
@@ -1545,6 +1577,93 @@ static void add_to_empty_tt_list (SECno sNo, TTEno tteno)
    sectors[sNo].empty_tt_list = tteno;
 }
 
+/* Some of the guest entry addresses of translations dumped by sector
+   recycling, so as to notice when they are translated again.  Many
+   such retranslations mean that the working set does not fit in the
+   cache.  Direct mapped, with new entries overwriting old ones.
+   Allocated when the first sector is recycled. */
+#define N_RECENTLY_DUMPED 65536
+
+static Addr* recently_dumped = NULL;
+
+static inline UInt recently_dumped_ix ( Addr entry )
+{
+   return HASH_TT(entry) & (N_RECENTLY_DUMPED - 1);
+}
+
+static void note_dumped ( Addr entry )
+{
+   if (recently_dumped == NULL) {
+      recently_dumped = ttaux_malloc("transtab.recently_dumped",
+                                     N_RECENTLY_DUMPED * sizeof(Addr));
+      for (UInt i = 0; i < N_RECENTLY_DUMPED; i++)
+         recently_dumped[i] = TRANSTAB_BOGUS_GUEST_ADDR;
+   }
+   recently_dumped[recently_dumped_ix(entry)] = entry;
+}
+
+static Bool was_recently_dumped ( Addr entry )
+{
+   if (recently_dumped == NULL)
+      return False;
+   UInt ix = recently_dumped_ix(entry);
+   if (recently_dumped[ix] != entry)
+      return False;
+   recently_dumped[ix] = TRANSTAB_BOGUS_GUEST_ADDR;
+   return True;
+}
+
+/* Guest entry addresses of translations that got hot.  From then on
+   these are translated with the hot settings, also after their hot
+   translation gets dumped by sector recycling.  Direct mapped; an
+   address overwritten by another one just has to get hot again.
+   Allocated when the first translation gets hot. */
+#define N_HOT_ADDRS 4096
+
+static Addr* hot_addrs = NULL;
+
+static inline UInt hot_addrs_ix ( Addr entry )
+{
+   return HASH_TT(entry) & (N_HOT_ADDRS - 1);
+}
+
+static void note_hot ( Addr entry )
+{
+   if (hot_addrs == NULL) {
+      hot_addrs = ttaux_malloc("transtab.hot_addrs",
+                               N_HOT_ADDRS * sizeof(Addr));
+      for (UInt i = 0; i < N_HOT_ADDRS; i++)
+         hot_addrs[i] = TRANSTAB_BOGUS_GUEST_ADDR;
+   }
+   hot_addrs[hot_addrs_ix(entry)] = entry;
+}
+
+Bool VG_(is_hot_guest_addr) ( Addr entry )
+{
+   return hot_addrs != NULL && hot_addrs[hot_addrs_ix(entry)] == entry;
+}
+
+/* If at least this percentage of the translations made during one
+   round of the sectors were of recently dumped code, the cache is
+   thrashing, and a sector is added if allowed. */
+#define THRASHING_RETRANSLATED_PERCENT 10
+
+static Bool is_thrashing ( void )
+{
+   return cycle_n_in_count > 0
+          && 100 * cycle_n_dump_retranslated
+             >= THRASHING_RETRANSLATED_PERCENT * cycle_n_in_count;
+}
+
+/* Memory used by one sector, not counting the eclass and host extent
+   arrays, which are small in comparison. */
+static ULong sector_szB ( void )
+{
+   return 8ULL * tc_sector_szQ
+          + N_TTES_PER_SECTOR * (sizeof(TTEntryC) + sizeof(TTEntryH))
+          + N_HTTES_PER_SECTOR * sizeof(TTEno);
+}
+
 static void initialiseSector ( SECno sno )
 {
    UInt i;
@@ -1666,6 +1785,7 @@ static void initialiseSector ( SECno sno )
             vg_assert(sec->ttC[ei].n_tte2ec >= 1);
             vg_assert(sec->ttC[ei].n_tte2ec <= 3);
             n_dump_osize += TTEntryH__osize(&sec->ttH[ei]);
+            note_dumped(sec->ttC[ei].entry);
             /* Tell the tool too. */
             if (VG_(needs).superblock_discards) {
                VexGuestExtents vge_tmp;
@@ -1742,7 +1862,8 @@ void VG_(add_to_transtab)( const VexGuestExtents* vge,
                            UInt             code_len,
                            Bool             is_self_checking,
                            Int              offs_profInc,
-                           UInt             n_guest_instrs )
+                           UInt             n_guest_instrs,
+                           Bool             is_hot )
 {
    Int    tcAvailQ, reqdQ, y;
    ULong  *tcptr, *tcptr2;
@@ -1771,6 +1892,13 @@ void VG_(add_to_transtab)( const VexGuestExtents* vge,
    n_in_osize += vge_osize(vge);
    if (is_self_checking)
       n_in_sc_count++;
+   if (is_hot)
+      n_in_hot_count++;
+   cycle_n_in_count++;
+   if (was_recently_dumped(entry)) {
+      n_dump_retranslated++;
+      cycle_n_dump_retranslated++;
+   }
 
    y = youngest_sector;
    vg_assert(isValidSector(y));
@@ -1806,8 +1934,28 @@ void VG_(add_to_transtab)( const VexGuestExtents* vge,
                    8 * (tc_sector_szQ - tcAvailQ)/sectors[y].tt_n_inuse);
       }
       youngest_sector++;
-      if (youngest_sector >= n_sectors)
-         youngest_sector = 0;
+      if (youngest_sector >= n_sectors) {
+         /* We are about to recycle the oldest sector, sector 0.  If
+            during this round of the sectors much of the code translated
+            was code we had already translated and then dumped, add a
+            sector instead, if we are allowed to.  This keeps the
+            sectors in order of age, as the new sector is the last
+            one. */
+         if (n_sectors < max_n_sectors && is_thrashing()) {
+            if (VG_(clo_stats) || VG_(debugLog_getLevel)() >= 1)
+               VG_(dmsg)("transtab: "
+                         "add sector %d (%'llu of %'llu new translations "
+                         "were of recently dumped code)\n",
+                         n_sectors, cycle_n_dump_retranslated,
+                         cycle_n_in_count);
+            n_sectors++;
+            n_sectors_added++;
+         } else {
+            youngest_sector = 0;
+         }
+         cycle_n_in_count = 0;
+         cycle_n_dump_retranslated = 0;
+      }
       y = youngest_sector;
       initialiseSector(y);
    }
@@ -1844,6 +1992,7 @@ void VG_(add_to_transtab)( const VexGuestExtents* vge,
    TTEntryH__init(&sectors[y].ttH[tteix]);
    sectors[y].ttC[tteix].tcptr  = tcptr;
    sectors[y].ttC[tteix].usage.prof.count  = 0;
+   sectors[y].ttC[tteix].usage.prof.hot    = is_hot;
 
    sectors[y].ttC[tteix].usage.prof.weight
       = False
@@ -2167,6 +2316,54 @@ SizeT delete_translations_in_sector ( /*OUT*/Addr* ga_deleted,
 } 
 
 
+/* Discard all translations that are not hot yet and have been
+   executed at least 'threshold' times, and remember their entry
+   addresses so that they get retranslated as hot translations.
+   Relies on the translations having been made with profile counters.
+   Returns the number of translations discarded. */
+
+UInt VG_(tier_up_hot_translations) ( ULong threshold )
+{
+   Sector* sec;
+   SECno   sno;
+   TTEno   i;
+   UInt    numDeleted = 0;
+   Addr    ga_deleted = TRANSTAB_BOGUS_GUEST_ADDR;
+
+   vg_assert(init_done);
+
+   VexArch     arch_host = VexArch_INVALID;
+   VexArchInfo archinfo_host;
+   VG_(bzero_inline)(&archinfo_host, sizeof(archinfo_host));
+   VG_(machine_get_VexArchInfo)( &arch_host, &archinfo_host );
+   VexEndness endness_host = archinfo_host.endness;
+
+   for (sno = 0; sno < n_sectors; sno++) {
+      sec = &sectors[sno];
+      if (sec->tc == NULL)
+         continue;
+      for (i = 0; i < N_TTES_PER_SECTOR; i++) {
+         if (sec->ttH[i].status != InUse)
+            continue;
+         const TTEntryC* tteC = &sec->ttC[i];
+         if (tteC->usage.prof.hot || tteC->usage.prof.count < threshold)
+            continue;
+         note_hot(tteC->entry);
+         delete_tte( &ga_deleted, sec, sno, i, arch_host, endness_host );
+         numDeleted++;
+      }
+   }
+
+   if (numDeleted > 0)
+      invalidateFastCache();
+   n_tiered_up += numDeleted;
+
+   VG_(debugLog)(2, "transtab",
+                    "tier_up_hot_translations: %u discarded\n", numDeleted);
+   return numDeleted;
+}
+
+
 void VG_(discard_translations) ( Addr guest_start, ULong range,
                                  const HChar* who )
 {
@@ -2602,6 +2799,9 @@ void VG_(init_tt_tc) ( void )
    n_sectors = VG_(clo_num_transtab_sectors);
    vg_assert(n_sectors >= MIN_N_SECTORS);
    vg_assert(n_sectors <= MAX_N_SECTORS);
+   max_n_sectors = VG_(clo_max_transtab_sectors) > n_sectors
+                      ? VG_(clo_max_transtab_sectors) : n_sectors;
+   vg_assert(max_n_sectors <= MAX_N_SECTORS);
 
    /* Initialise the sectors, even the ones we aren't going to use.
       Set all fields to zero. */
@@ -2633,6 +2833,10 @@ void VG_(init_tt_tc) ( void )
          "TT/TC: cache: %d sectors of %'d bytes each = %'d total TC\n", 
           n_sectors, 8 * tc_sector_szQ,
           n_sectors * 8 * tc_sector_szQ );
+      if (max_n_sectors > n_sectors)
+         VG_(message)(Vg_DebugMsg,
+            "TT/TC: cache: can grow to %d sectors if thrashing\n",
+            max_n_sectors);
       VG_(message)(Vg_DebugMsg,
          "TT/TC: table: %'d tables[%d] of C %'d + H %'d bytes each "
          "= %'d total TT\n",
@@ -2709,6 +2913,27 @@ void VG_(print_tt_tc_stats) ( void )
    VG_(message)(Vg_DebugMsg,
                 " transtab: discarded  %'llu (%'llu -> ?" "?)\n",
                 n_disc_count, n_disc_osize );
+   VG_(message)(Vg_DebugMsg,
+                " transtab: retranslated %'llu recently dumped "
+                "(sectors added %'llu)\n",
+                n_dump_retranslated, n_sectors_added );
+   if (VG_(clo_tier_up_threshold) > 0)
+      VG_(message)(Vg_DebugMsg,
+                   " transtab: tiered up %'llu, new hot %'llu\n",
+                   n_tiered_up, n_in_hot_count );
+
+   { SECno sno;
+     UInt  n_alloc = 0;
+     for (sno = 0; sno < n_sectors; sno++) {
+        if (sectors[sno].tc != NULL)
+           n_alloc++;
+     }
+     VG_(message)(Vg_DebugMsg,
+                  " transtab: %u of %d sectors allocated (max %d), "
+                  "%'llu MB\n",
+                  n_alloc, n_sectors, max_n_sectors,
+                  (n_alloc * sector_szB()) / (1024 * 1024));
+   }
 
    if (DEBUG_TRANSTAB) {
       VG_(printf)("\n");
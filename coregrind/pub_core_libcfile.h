@@ -93,6 +93,11 @@ extern Int VG_(check_executable)(/*OUT*/Bool* is_setuid,
    in terms of pread()?) */
 extern SysRes VG_(pread) ( Int fd, void* buf, Int count, OffT offset );
 
+/* Tells the kernel that [offset, offset+len) of fd will be read soon,
+   so that it can start reading it in.  Only a hint: it does not wait
+   for the data, and is not implemented on all platforms. */
+extern SysRes VG_(fadvise_willneed) ( Int fd, OffT offset, OffT len );
+
 /* Size of fullname buffer needed for a call to VG_(mkstemp) with
    part_of_name having the given part_of_name_len. */
 extern SizeT VG_(mkstemp_fullname_bufsz) ( SizeT part_of_name_len );
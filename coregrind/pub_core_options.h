@@ -173,6 +173,10 @@ extern const HChar* VG_(clo_debuginfo_server);
    _debuginfo_server. */
 extern Bool VG_(clo_allow_mismatched_debuginfo);
 
+/* Directory in which to cache the debuginfo tables of objects, keyed by
+   their build-id.  NULL (the default) disables the cache. */
+extern const HChar* VG_(clo_debuginfo_cache);
+
 /* DEBUG: print generated code?  default: 00000000 ( == NO ) */
 extern UChar VG_(clo_trace_flags);
 
@@ -262,6 +266,9 @@ extern Bool VG_(clo_sym_offsets);
 extern Bool VG_(clo_read_inline_info);
 /* Read DWARF3 variable info even if tool doesn't ask for it? */
 extern Bool VG_(clo_read_var_info);
+/* Have the DWARF sections of objects read in by the kernel as soon as
+   they are mapped? */
+extern Bool VG_(clo_prefetch_debuginfo);
 /* Which prefix to strip from full source file paths, if any. */
 extern const HChar* VG_(clo_prefix_to_strip);
 
@@ -340,6 +347,16 @@ extern Int VG_(clo_merge_recursive_frames);
 /* Max number of sectors that will be used by the translation code cache. */
 extern UInt VG_(clo_num_transtab_sectors);
 
+/* Number of sectors the translation code cache may grow to, when many
+   translations have to be redone because their sectors got recycled.
+   Values <= VG_(clo_num_transtab_sectors) disable the growth. */
+extern UInt VG_(clo_max_transtab_sectors);
+
+/* Number of executions after which a translation is discarded and
+   redone with longer superblocks and more optimisation.  0 disables
+   this. */
+extern UInt VG_(clo_tier_up_threshold);
+
 /* Average size of a transtab code entry. 0 means to use the tool
    provided default. */
 extern UInt VG_(clo_avg_transtab_entry_size);
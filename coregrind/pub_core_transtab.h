@@ -174,7 +174,8 @@ void VG_(add_to_transtab)( const VexGuestExtents* vge,
                            UInt             code_len,
                            Bool             is_self_checking,
                            Int              offs_profInc,
-                           UInt             n_guest_instrs );
+                           UInt             n_guest_instrs,
+                           Bool             is_hot );
 
 typedef UShort SECno; // SECno type identifies a sector
 typedef UShort TTEno; // TTEno type identifies a TT entry in a sector.
@@ -198,6 +199,13 @@ extern Bool VG_(search_transtab) ( /*OUT*/Addr*  res_hcode,
 extern void VG_(discard_translations) ( Addr  start, ULong range,
                                         const HChar* who );
 
+// For --tier-up-threshold: discard the translations executed at least
+// threshold times, so that they get redone as hot translations.
+extern UInt VG_(tier_up_hot_translations) ( ULong threshold );
+
+// Whether the code at this guest address got hot.
+extern Bool VG_(is_hot_guest_addr) ( Addr entry );
+
 extern void VG_(print_tt_tc_stats) ( void );
 
 extern ULong VG_(get_bbs_translated) ( void );
@@ -346,17 +346,10 @@ Bool DRD_(bm_has_any_load_g)(struct bitmap* const bm)
 
    VG_(OSetGen_ResetIter)(bm->oset);
    for ( ; (bm2 = VG_(OSetGen_Next)(bm->oset)) != NULL; ) {
-      Addr b_start;
-      Addr b_end;
-      UWord b0;
       const struct bitmap1* const p1 = &bm2->bm1;
 
-      b_start = make_address(bm2->addr, 0);
-      b_end = make_address(bm2->addr + 1, 0);
-
-      for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
-         if (bm0_is_set(p1->bm0_r, b0))
-            return True;
+      if (bm0_is_any_set_in(p1->bm0_r, 0, ADDR_LSB_MASK))
+         return True;
    }
    return False;
 }
@@ -382,7 +375,6 @@ DRD_(bm_has_any_load)(struct bitmap* const bm, const Addr a1, const Addr a2)
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
          const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
@@ -402,12 +394,10 @@ DRD_(bm_has_any_load)(struct bitmap* const bm, const Addr a1, const Addr a2)
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         if (bm0_is_any_set_in(p1->bm0_r, address_lsb(b_start),
+                               address_lsb(b_end - 1)))
          {
-            if (bm0_is_set(p1->bm0_r, b0))
-            {
-               return True;
-            }
+            return True;
          }
       }
    }
@@ -435,7 +425,6 @@ Bool DRD_(bm_has_any_store)(struct bitmap* const bm,
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
          const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
@@ -455,12 +444,10 @@ Bool DRD_(bm_has_any_store)(struct bitmap* const bm,
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         if (bm0_is_any_set_in(p1->bm0_w, address_lsb(b_start),
+                               address_lsb(b_end - 1)))
          {
-            if (bm0_is_set(p1->bm0_w, b0))
-            {
-               return True;
-            }
+            return True;
          }
       }
    }
@@ -490,7 +477,6 @@ Bool DRD_(bm_has_any_access)(struct bitmap* const bm,
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
          const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
@@ -510,16 +496,16 @@ Bool DRD_(bm_has_any_access)(struct bitmap* const bm,
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         /*
+          * Note: the statement below uses a binary or instead of a logical
+          * or on purpose.
+          */
+         if (bm0_is_any_set_in(p1->bm0_r, address_lsb(b_start),
+                               address_lsb(b_end - 1))
+             | bm0_is_any_set_in(p1->bm0_w, address_lsb(b_start),
+                                 address_lsb(b_end - 1)))
          {
-            /*
-             * Note: the statement below uses a binary or instead of a logical
-             * or on purpose.
-             */
-            if (bm0_is_set(p1->bm0_r, b0) | bm0_is_set(p1->bm0_w, b0))
-            {
-               return True;
-            }
+            return True;
          }
       }
    }
@@ -823,7 +809,6 @@ Bool DRD_(bm_has_conflict_with)(struct bitmap* const bm,
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
          const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
@@ -843,23 +828,23 @@ Bool DRD_(bm_has_conflict_with)(struct bitmap* const bm,
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         if (access_type == eLoad)
          {
-            if (access_type == eLoad)
+            if (bm0_is_any_set_in(p1->bm0_w, address_lsb(b_start),
+                                  address_lsb(b_end - 1)))
             {
-               if (bm0_is_set(p1->bm0_w, b0))
-               {
-                  return True;
-               }
+               return True;
             }
-            else
+         }
+         else
+         {
+            tl_assert(access_type == eStore);
+            if (bm0_is_any_set_in(p1->bm0_r, address_lsb(b_start),
+                                  address_lsb(b_end - 1))
+                | bm0_is_any_set_in(p1->bm0_w, address_lsb(b_start),
+                                    address_lsb(b_end - 1)))
             {
-               tl_assert(access_type == eStore);
-               if (bm0_is_set(p1->bm0_r, b0)
-                   | bm0_is_set(p1->bm0_w, b0))
-               {
-                  return True;
-               }
+               return True;
             }
          }
       }
@@ -1183,18 +1168,25 @@ int DRD_(bm_has_races)(struct bitmap* const lhs, struct bitmap* const rhs)
       bm1l = &bm2l->bm1;
       bm1r = &bm2r->bm1;
 
+      /*
+       * Compute the RW / WR / WW patterns of a whole UWord at once and only
+       * look at the individual bits of the UWords in which such a pattern
+       * has been found. The result is the same as that of evaluating
+       * HAS_RACE() for each bit.
+       */
       for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
       {
+         UWord const races
+            = (bm1r->bm0_w[k] & (bm1l->bm0_r[k] | bm1l->bm0_w[k]))
+            | (bm1l->bm0_w[k] & (bm1r->bm0_r[k] | bm1r->bm0_w[k]));
          unsigned b;
+
+         if (races == 0)
+            continue;
          for (b = 0; b < BITS_PER_UWORD; b++)
          {
-            UWord const access_mask
-               = ((bm1l->bm0_r[k] & bm0_mask(b)) ? LHS_R : 0)
-               | ((bm1l->bm0_w[k] & bm0_mask(b)) ? LHS_W : 0)
-               | ((bm1r->bm0_r[k] & bm0_mask(b)) ? RHS_R : 0)
-               | ((bm1r->bm0_w[k] & bm0_mask(b)) ? RHS_W : 0);
             Addr const a = make_address(bm2l->addr, k * BITS_PER_UWORD | b);
-            if (HAS_RACE(access_mask) && ! DRD_(is_suppressed)(a, a + 1))
+            if ((races & bm0_mask(b)) && ! DRD_(is_suppressed)(a, a + 1))
             {
                return 1;
             }
@@ -1267,12 +1259,10 @@ void bm2_merge(struct bitmap2* const bm2l, const struct bitmap2* const bm2r)
 
    s_bitmap2_merge_count++;
 
+   /* A single branch-free loop that the compiler can vectorize. */
    for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
    {
       bm2l->bm1.bm0_r[k] |= bm2r->bm1.bm0_r[k];
-   }
-   for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
-   {
       bm2l->bm1.bm0_w[k] |= bm2r->bm1.bm0_w[k];
    }
 }
@@ -322,6 +322,34 @@ static __inline__ UWord bm0_is_any_set(const UWord* bm0,
    return (bm0[uword_msb(a)] & ((((UWord)1 << size) - 1) << uword_lsb(a)));
 }
 
+/**
+ * Return a non-zero value if a bit corresponding to any of the address LSBs
+ * in range [ b0_first .. b0_last ] is set in bm0. Unlike bm0_is_any_set(),
+ * the range may span multiple UWords. The words in between the first and
+ * the last word are OR-ed together without branches such that the compiler
+ * can vectorize that loop.
+ */
+static __inline__ UWord bm0_is_any_set_in(const UWord* bm0,
+                                          const UWord b0_first,
+                                          const UWord b0_last)
+{
+   const UWord k1 = uword_msb(b0_first);
+   const UWord k2 = uword_msb(b0_last);
+   const UWord m1 = ~(UWord)0 << uword_lsb(b0_first);
+   const UWord m2 = ~(UWord)0 >> (BITS_PER_UWORD - 1 - uword_lsb(b0_last));
+   UWord k, result;
+
+#ifdef ENABLE_DRD_CONSISTENCY_CHECKS
+   tl_assert(b0_first <= b0_last);
+#endif
+   if (k1 == k2)
+      return bm0[k1] & m1 & m2;
+   result = (bm0[k1] & m1) | (bm0[k2] & m2);
+   for (k = k1 + 1; k < k2; k++)
+      result |= bm0[k];
+   return result;
+}
+
 
 
 /*********************************************************************/
@@ -76,6 +76,7 @@ static void sg_init(Segment* const sg,
    sg->thr_next = NULL;
    sg->thr_prev = NULL;
    sg->tid = created;
+   sg->merge_blocker = DRD_INVALID_THREADID;
    sg->refcnt = 1;
 
    if (vg_created != VG_INVALID_THREADID && VG_(get_SP)(vg_created) != 0)
@@ -45,6 +45,11 @@ typedef struct segment
    struct segment*    thr_next;
    struct segment*    thr_prev;
    DrdThreadId        tid;
+   /**
+    * Thread with segments that prevented merging this segment with the next
+    * segment of the same thread during the most recent attempt.
+    */
+   DrdThreadId        merge_blocker;
    /** Reference count: number of pointers that point to this segment. */
    int                refcnt;
    /** Stack trace of the first instruction of the segment. */
@@ -76,6 +76,12 @@ static int      s_segment_merge_interval = 10;
 static unsigned s_join_list_vol = 10;
 static unsigned s_deletion_head;
 static unsigned s_deletion_tail;
+/** Index of the set CS, see also thread_build_cs_index(). */
+static struct { DrdThreadId tid; unsigned begin; unsigned end; }* s_cs_range;
+static unsigned s_cs_range_count;
+static unsigned* s_cs_range_of;
+static Segment** s_cs_sg;
+static unsigned s_cs_sg_capacity;
 #if defined(VGO_solaris)
 Bool DRD_(ignore_thread_creation) = True;
 #else
@@ -178,6 +184,30 @@ DrdThreadId DRD_(VgThreadIdToDrdThreadId)(const ThreadId tid)
    return DRD_INVALID_THREADID;
 }
 
+/**
+ * Reset the segment order index of thread ID tid, and forget what the other
+ * threads know about the segments of a previous thread with the same ID.
+ */
+static void thread_reset_sg_ordered_count(const DrdThreadId tid)
+{
+   UInt i;
+
+   if (DRD_(g_threadinfo)[tid].sg_ordered_count == NULL)
+      DRD_(g_threadinfo)[tid].sg_ordered_count
+         = VG_(malloc)("drd.thread.soc.1",
+                       DRD_N_THREADS
+                       * sizeof(DRD_(g_threadinfo)[tid].sg_ordered_count[0]));
+   VG_(memset)(DRD_(g_threadinfo)[tid].sg_ordered_count, 0,
+               DRD_N_THREADS
+               * sizeof(DRD_(g_threadinfo)[tid].sg_ordered_count[0]));
+
+   for (i = 1; i < DRD_N_THREADS; i++)
+   {
+      if (DRD_(g_threadinfo)[i].sg_ordered_count)
+         DRD_(g_threadinfo)[i].sg_ordered_count[tid] = 0;
+   }
+}
+
 /** Allocate a new DRD thread ID for the specified Valgrind thread ID. */
 static DrdThreadId DRD_(VgThreadIdToNewDrdThreadId)(const ThreadId tid)
 {
@@ -214,6 +244,8 @@ static DrdThreadId DRD_(VgThreadIdToNewDrdThreadId)(const ThreadId tid)
          tl_assert(DRD_(g_threadinfo)[i].sg_first == NULL);
          tl_assert(DRD_(g_threadinfo)[i].sg_last == NULL);
 
+         thread_reset_sg_ordered_count(i);
+
          tl_assert(DRD_(IsValidDrdThreadId)(i));
 
          return i;
@@ -916,6 +948,83 @@ void DRD_(thread_get_latest_segment)(Segment** sg, const DrdThreadId tid)
    *sg = DRD_(sg_get)(latest_sg);
 }
 
+/**
+ * Return whether DRD_(vc_lte)(&sg->vc, vc) holds. The counter of thread
+ * sg->tid is the counter in which sg->vc and vc are most likely to differ,
+ * so check that counter first.
+ */
+static __inline__
+Bool sg_lte_vc(const Segment* const sg, const VectorClock* const vc)
+{
+   if (DRD_(vc_get)(&sg->vc, sg->tid) > DRD_(vc_get)(vc, sg->tid))
+      return False;
+   return DRD_(vc_lte)(&sg->vc, vc);
+}
+
+/**
+ * Return whether DRD_(vc_lte)(vc, &sg->vc) holds, where vc is a vector clock
+ * of thread tid.
+ */
+static __inline__
+Bool vc_lte_sg(const DrdThreadId tid, const VectorClock* const vc,
+               const Segment* const sg)
+{
+   if (DRD_(vc_get)(vc, tid) > DRD_(vc_get)(&sg->vc, tid))
+      return False;
+   return DRD_(vc_lte)(vc, &sg->vc);
+}
+
+/**
+ * Return whether DRD_(vc_lte)(&sg->vc, vc) holds, where sg is a segment in
+ * the segment list of another thread than tid and where vc is the current
+ * vector clock of thread tid.
+ *
+ * The vector clock of a segment that is not the latest segment of its thread
+ * no longer changes, and such segments are ordered by their vector clocks
+ * and by their counter for their own thread. The vector clock of a thread
+ * only increases. So once such a segment has been found to be ordered before
+ * a vector clock of thread tid, this also holds for all later vector clocks
+ * of thread tid and all earlier segments of the same thread. The highest
+ * counter for which that is known is kept in sg_ordered_count[], which
+ * turns most of these tests into an array lookup instead of a comparison of
+ * two vector clocks with as many elements as there are threads.
+ */
+static __inline__
+Bool thread_sg_lte_vc(const DrdThreadId tid, const Segment* const sg,
+                      const VectorClock* const vc)
+{
+   UInt* const ordered_count = DRD_(g_threadinfo)[tid].sg_ordered_count;
+   const UInt count = DRD_(vc_get)(&sg->vc, sg->tid);
+
+#ifdef ENABLE_DRD_CONSISTENCY_CHECKS
+   tl_assert(sg->tid != tid);
+#endif
+   if (count > DRD_(vc_get)(vc, sg->tid))
+      return False;
+   if (sg->thr_next && count <= ordered_count[sg->tid])
+      return True;
+   if (!DRD_(vc_lte)(&sg->vc, vc))
+      return False;
+   if (sg->thr_next)
+      ordered_count[sg->tid] = count;
+   return True;
+}
+
+/**
+ * Return whether DRD_(vc_lte)(&sg1->vc, &sg2->vc) holds, where sg2 is a
+ * segment in the segment list of thread tid2. The vector clock of the latest
+ * segment of a thread is the current vector clock of that thread, which
+ * allows to use thread_sg_lte_vc() for such segments.
+ */
+static __inline__
+Bool sg_lte_sg(const Segment* const sg1, const DrdThreadId tid2,
+               const Segment* const sg2)
+{
+   if (!sg2->thr_next && sg1->tid != tid2)
+      return thread_sg_lte_vc(tid2, sg1, &sg2->vc);
+   return sg_lte_vc(sg1, &sg2->vc);
+}
+
 /**
  * Compute the minimum of all latest vector clocks of all threads
  * (Michiel Ronsse calls this "clock snooping" in his papers about DIOTA).
@@ -1004,7 +1113,7 @@ static void thread_discard_ordered_segments(void)
 
       for (sg = DRD_(g_threadinfo)[i].sg_first;
            sg && (sg_next = sg->thr_next)
-              && DRD_(vc_lte)(&sg->vc, &thread_vc_min);
+              && sg_lte_vc(sg, &thread_vc_min);
            sg = sg_next)
       {
          thread_discard_segment(i, sg);
@@ -1013,6 +1122,36 @@ static void thread_discard_ordered_segments(void)
    DRD_(vc_cleanup)(&thread_vc_min);
 }
 
+/**
+ * Check the part of the property 'equiv(sg1, sg2)' (see below) that involves
+ * the segments of range r of the index of the set CS.
+ */
+static Bool thread_cs_range_consistent(const unsigned r,
+                                       const Segment* const sg1,
+                                       const Segment* const sg2)
+{
+   const DrdThreadId i = s_cs_range[r].tid;
+   unsigned n;
+
+   for (n = s_cs_range[r].begin; n < s_cs_range[r].end; n++) {
+      const Segment* const sg = s_cs_sg[n];
+
+      if (sg_lte_sg(sg2, i, sg))
+         break;
+      if (sg_lte_sg(sg1, i, sg))
+         return False;
+   }
+   for (n = s_cs_range[r].end; n > s_cs_range[r].begin; n--) {
+      const Segment* const sg = s_cs_sg[n - 1];
+
+      if (sg_lte_vc(sg, &sg1->vc))
+         break;
+      if (sg_lte_vc(sg, &sg2->vc))
+         return False;
+   }
+   return True;
+}
+
 /**
  * An implementation of the property 'equiv(sg1, sg2)' as defined in the paper
  * by Mark Christiaens e.a. The property equiv(sg1, sg2) holds if and only if
@@ -1021,7 +1160,8 @@ static void thread_discard_ordered_segments(void)
  * precede future segments via inter-thread synchronization operations. In
  * DRD the set CS consists of the latest segment of each thread combined with
  * all segments for which the reference count is strictly greater than one.
- * The code below is an optimized version of the following:
+ * The code below is an optimized version of the following, that only looks
+ * at the segments in CS as collected by thread_build_cs_index():
  *
  * for (i = 0; i < DRD_N_THREADS; i++)
  * {
@@ -1046,35 +1186,82 @@ static Bool thread_consistent_segment_ordering(const DrdThreadId tid,
                                                Segment* const sg1,
                                                Segment* const sg2)
 {
-   unsigned i;
+   unsigned r;
 
    tl_assert(sg1->thr_next);
    tl_assert(sg2->thr_next);
    tl_assert(sg1->thr_next == sg2);
    tl_assert(DRD_(vc_lte)(&sg1->vc, &sg2->vc));
 
+   /*
+    * Segments that could not be merged usually cannot be merged during the
+    * next attempt either, and for the same reason. So start with the thread
+    * whose segments prevented merging last time.
+    */
+   if (sg1->merge_blocker != DRD_INVALID_THREADID
+       && s_cs_range_of[sg1->merge_blocker] < s_cs_range_count
+       && !thread_cs_range_consistent(s_cs_range_of[sg1->merge_blocker],
+                                      sg1, sg2))
+      return False;
+
+   for (r = 0; r < s_cs_range_count; r++)
+   {
+      if (!thread_cs_range_consistent(r, sg1, sg2))
+      {
+         sg1->merge_blocker = s_cs_range[r].tid;
+         return False;
+      }
+   }
+   return True;
+}
+
+/**
+ * Build the index of the set CS used by thread_consistent_segment_ordering():
+ * the segments in the set CS, per thread and in segment list order. Merging
+ * segments does not change the set CS, so the index remains valid during
+ * thread_merge_segments().
+ */
+static void thread_build_cs_index(void)
+{
+   unsigned i;
+   unsigned n = 0;
+
+   if (s_cs_range == NULL)
+   {
+      s_cs_range = VG_(malloc)("drd.thread.csi.1",
+                               DRD_N_THREADS * sizeof(s_cs_range[0]));
+      s_cs_range_of = VG_(malloc)("drd.thread.csi.3",
+                                  DRD_N_THREADS * sizeof(s_cs_range_of[0]));
+   }
+   if (s_cs_sg_capacity < DRD_(sg_get_segments_alive_count)())
+   {
+      s_cs_sg_capacity = 2 * DRD_(sg_get_segments_alive_count)();
+      s_cs_sg = VG_(realloc)("drd.thread.csi.2", s_cs_sg,
+                             s_cs_sg_capacity * sizeof(s_cs_sg[0]));
+   }
+
+   s_cs_range_count = 0;
    for (i = 0; i < DRD_N_THREADS; i++)
    {
       Segment* sg;
 
-      for (sg = DRD_(g_threadinfo)[i].sg_first; sg; sg = sg->thr_next) {
-         if (!sg->thr_next || DRD_(sg_get_refcnt)(sg) > 1) {
-            if (DRD_(vc_lte)(&sg2->vc, &sg->vc))
-               break;
-            if (DRD_(vc_lte)(&sg1->vc, &sg->vc))
-               return False;
-         }
+      if (DRD_(g_threadinfo)[i].sg_first == NULL)
+      {
+         s_cs_range_of[i] = DRD_N_THREADS;
+         continue;
       }
-      for (sg = DRD_(g_threadinfo)[i].sg_last; sg; sg = sg->thr_prev) {
+      s_cs_range_of[i] = s_cs_range_count;
+      s_cs_range[s_cs_range_count].tid = i;
+      s_cs_range[s_cs_range_count].begin = n;
+      for (sg = DRD_(g_threadinfo)[i].sg_first; sg; sg = sg->thr_next) {
          if (!sg->thr_next || DRD_(sg_get_refcnt)(sg) > 1) {
-            if (DRD_(vc_lte)(&sg->vc, &sg1->vc))
-               break;
-            if (DRD_(vc_lte)(&sg->vc, &sg2->vc))
-               return False;
+            tl_assert(n < s_cs_sg_capacity);
+            s_cs_sg[n++] = sg;
          }
       }
+      s_cs_range[s_cs_range_count].end = n;
+      s_cs_range_count++;
    }
-   return True;
 }
 
 /**
@@ -1102,6 +1289,8 @@ static void thread_merge_segments(void)
 
    s_new_segments_since_last_merge = 0;
 
+   thread_build_cs_index();
+
    for (i = 0; i < DRD_N_THREADS; i++)
    {
       Segment* sg;
@@ -1564,6 +1753,7 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
    const VectorClock* new_vc;
    Segment* p;
    unsigned j;
+   Bool marked = False;
 
    tl_assert(0 <= (int)tid && tid < DRD_N_THREADS
              && tid != DRD_INVALID_THREADID);
@@ -1594,12 +1784,12 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
          continue;
 
       for (q = DRD_(g_threadinfo)[j].sg_last;
-           q && !DRD_(vc_lte)(&q->vc, new_vc);
+           q && !thread_sg_lte_vc(tid, q, new_vc);
            q = q->thr_prev) {
          const Bool included_in_old_conflict_set
-            = !DRD_(vc_lte)(old_vc, &q->vc);
+            = !vc_lte_sg(tid, old_vc, q);
          const Bool included_in_new_conflict_set
-            = !DRD_(vc_lte)(new_vc, &q->vc);
+            = !vc_lte_sg(tid, new_vc, q);
 
          if (UNLIKELY(s_trace_conflict_set)) {
             HChar* str;
@@ -1613,15 +1803,18 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
             VG_(free)(str);
          }
          if (included_in_old_conflict_set != included_in_new_conflict_set)
+         {
             DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+            marked = True;
+         }
       }
 
-      for ( ; q && !DRD_(vc_lte)(&q->vc, old_vc); q = q->thr_prev) {
+      for ( ; q && !sg_lte_vc(q, old_vc); q = q->thr_prev) {
          const Bool included_in_old_conflict_set
-            = !DRD_(vc_lte)(old_vc, &q->vc);
+            = !vc_lte_sg(tid, old_vc, q);
          const Bool included_in_new_conflict_set
-            = !DRD_(vc_lte)(&q->vc, new_vc)
-            && !DRD_(vc_lte)(new_vc, &q->vc);
+            = !thread_sg_lte_vc(tid, q, new_vc)
+            && !vc_lte_sg(tid, new_vc, q);
 
          if (UNLIKELY(s_trace_conflict_set)) {
             HChar* str;
@@ -1635,26 +1828,36 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
             VG_(free)(str);
          }
          if (included_in_old_conflict_set != included_in_new_conflict_set)
+         {
             DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+            marked = True;
+         }
       }
    }
 
-   DRD_(bm_clear_marked)(DRD_(g_conflict_set));
+   /*
+    * If the vector clock update did not move any segment into or out of the
+    * conflict set then there is nothing to recalculate.
+    */
+   if (marked) {
+      DRD_(bm_clear_marked)(DRD_(g_conflict_set));
 
-   p = DRD_(g_threadinfo)[tid].sg_last;
-   for (j = 0; j < DRD_N_THREADS; j++) {
-      if (j != tid && DRD_(IsValidDrdThreadId)(j)) {
-         Segment* q;
-         for (q = DRD_(g_threadinfo)[j].sg_last;
-              q && !DRD_(vc_lte)(&q->vc, &p->vc);
-              q = q->thr_prev) {
-            if (!DRD_(vc_lte)(&p->vc, &q->vc))
-               DRD_(bm_merge2_marked)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+      p = DRD_(g_threadinfo)[tid].sg_last;
+      for (j = 0; j < DRD_N_THREADS; j++) {
+         if (j != tid && DRD_(IsValidDrdThreadId)(j)) {
+            Segment* q;
+            for (q = DRD_(g_threadinfo)[j].sg_last;
+                 q && !thread_sg_lte_vc(tid, q, &p->vc);
+                 q = q->thr_prev) {
+               if (!vc_lte_sg(tid, &p->vc, q))
+                  DRD_(bm_merge2_marked)(DRD_(g_conflict_set),
+                                         DRD_(sg_bm)(q));
+            }
          }
       }
-   }
 
-   DRD_(bm_remove_cleared_marked)(DRD_(g_conflict_set));
+      DRD_(bm_remove_cleared_marked)(DRD_(g_conflict_set));
+   }
 
    s_update_conflict_set_count++;
 
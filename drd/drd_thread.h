@@ -101,6 +101,14 @@ typedef struct
     * thread is fully created. Then the creator thread lives its own life again.
     */
    DrdThreadId creator_thread;
+   /**
+    * Index of the segments of other threads that happened before the current
+    * segment of this thread: element j is the highest counter of thread j
+    * of a segment of thread j that is not the latest segment of thread j and
+    * whose vector clock is known to be less than or equal to a vector clock
+    * of this thread. Zero if no such segment is known yet.
+    */
+   UInt*     sg_ordered_count;
 
 #if defined(VGO_solaris)
    Int       bind_guard_flag; /**< Bind flag from the runtime linker. */
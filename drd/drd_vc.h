@@ -78,6 +78,8 @@ void DRD_(vc_increment)(VectorClock* const vc, DrdThreadId const tid);
 static __inline__
 Bool DRD_(vc_lte)(const VectorClock* const vc1,
                   const VectorClock* const vc2);
+static __inline__
+UInt DRD_(vc_get)(const VectorClock* const vc, const DrdThreadId tid);
 Bool DRD_(vc_ordered)(const VectorClock* const vc1,
                       const VectorClock* const vc2);
 void DRD_(vc_min)(VectorClock* const result,
@@ -121,5 +123,30 @@ Bool DRD_(vc_lte)(const VectorClock* const vc1, const VectorClock* const vc2)
    return True;
 }
 
+/**
+ * @return The counter of thread tid in vector clock vc, or zero if vc does
+ *    not contain a counter for thread tid. Uses a binary search since the
+ *    elements of vc are sorted by thread id.
+ */
+static __inline__
+UInt DRD_(vc_get)(const VectorClock* const vc, const DrdThreadId tid)
+{
+   unsigned lo = 0;
+   unsigned hi = vc->size;
+
+   while (lo < hi)
+   {
+      const unsigned mid = (lo + hi) / 2;
+
+      if (vc->vc[mid].threadid < tid)
+         lo = mid + 1;
+      else if (vc->vc[mid].threadid > tid)
+         hi = mid;
+      else
+         return vc->vc[mid].count;
+   }
+   return 0;
+}
+
 
 #endif /* __DRD_VC_H */
@@ -0,0 +1,62 @@
+// Thread-count scaling benchmark: each of the threads repeatedly acquires a
+// lock shared by all threads, updates a shared counter, releases the lock
+// and then updates thread-private data. Every lock acquisition creates a
+// new segment and hence makes DRD update its conflict set, which is where
+// the cost of the thread count shows up. Run with e.g.
+//   time valgrind --tool=drd thread_scaling <nr_threads> <nr_iterations>
+// for increasing thread counts.
+
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#define PRIVATE_WORDS 16
+
+static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int s_iterations = 100;
+static long s_counter;
+
+static void* thread_func(void* arg)
+{
+  long private_data[PRIVATE_WORDS] = { 0 };
+  long sum = 0;
+  int i, j;
+
+  for (i = 0; i < s_iterations; i++)
+  {
+    pthread_mutex_lock(&s_mutex);
+    s_counter++;
+    pthread_mutex_unlock(&s_mutex);
+    for (j = 0; j < PRIVATE_WORDS; j++)
+      private_data[j] += i + j;
+  }
+  for (j = 0; j < PRIVATE_WORDS; j++)
+    sum += private_data[j];
+  return (void*)sum;
+}
+
+int main(int argc, char** argv)
+{
+  int thread_count = argc > 1 ? atoi(argv[1]) : 16;
+  pthread_t* tid;
+  int i;
+
+  if (argc > 2)
+    s_iterations = atoi(argv[2]);
+  assert(thread_count >= 1 && s_iterations >= 1);
+
+  tid = malloc(thread_count * sizeof(tid[0]));
+  assert(tid);
+  for (i = 0; i < thread_count; i++)
+    pthread_create(&tid[i], 0, thread_func, 0);
+  for (i = 0; i < thread_count; i++)
+    pthread_join(tid[i], 0);
+  free(tid);
+
+  fprintf(stderr, "counter = %ld\n", s_counter);
+
+  return 0;
+}
@@ -59,7 +59,7 @@ UInt VG_(printf)(const HChar *format, ...)
 UInt VG_(message)(VgMsgKind kind, const HChar* format, ...)
 { UInt ret; va_list vargs; va_start(vargs, format); ret = vprintf(format, vargs); va_end(vargs); printf("\n"); return ret; }
 Bool DRD_(is_suppressed)(const Addr a1, const Addr a2)
-{ assert(0); }
+{ return False; }
 void VG_(vcbprintf)(void(*char_sink)(HChar, void* opaque),
                     void* opaque,
                     const HChar* format, va_list vargs)
@@ -319,6 +319,60 @@ void bm_test3(const int outer_loop_step, const int inner_loop_step)
   DRD_(bm_delete)(bm1);
 }
 
+/**
+ * Test the functions that look for any access in a range of addresses and
+ * DRD_(bm_has_races)() against a bit-by-bit evaluation via DRD_(bm_has_1)().
+ */
+void bm_test4(const int step)
+{
+  const Addr lb = make_address(1, 0) - 3 * BITS_PER_UWORD - 5;
+  const Addr ub = make_address(1, 0) + 3 * BITS_PER_UWORD + 7;
+  struct bitmap* bm1;
+  struct bitmap* bm2;
+  Addr a, b, c;
+
+  assert(step >= 1);
+
+  bm1 = DRD_(bm_new)();
+  for (a = lb; a < ub; a += 11)
+    DRD_(bm_access_load_1)(bm1, a);
+  for (a = lb + 3; a < ub; a += 20)
+    DRD_(bm_access_store_1)(bm1, a);
+
+  for (a = lb - 1; a < ub; a += step)
+  {
+    for (b = a + 1; b <= ub; b += step)
+    {
+      Bool r = False, w = False;
+
+      for (c = a; c < b; c++)
+      {
+        r |= DRD_(bm_has_1)(bm1, c, eLoad) != 0;
+        w |= DRD_(bm_has_1)(bm1, c, eStore) != 0;
+      }
+      assert(DRD_(bm_has_any_load)(bm1, a, b) == r);
+      assert(DRD_(bm_has_any_store)(bm1, a, b) == w);
+      assert(DRD_(bm_has_any_access)(bm1, a, b) == (r || w));
+      assert(DRD_(bm_load_has_conflict_with)(bm1, a, b) == w);
+      assert(DRD_(bm_store_has_conflict_with)(bm1, a, b) == (r || w));
+    }
+  }
+  assert(DRD_(bm_has_any_load_g)(bm1));
+
+  /* Loads and stores that do not overlap, then a load / store conflict. */
+  bm2 = DRD_(bm_new)();
+  for (a = lb + 1; a < ub; a += 4)
+    DRD_(bm_access_load_1)(bm2, a);
+  assert(! DRD_(bm_has_races)(bm1, bm2));
+  assert(! DRD_(bm_has_races)(bm2, bm1));
+  DRD_(bm_access_store_1)(bm2, lb + 11 * 20);
+  assert(DRD_(bm_has_races)(bm1, bm2));
+  assert(DRD_(bm_has_races)(bm2, bm1));
+
+  DRD_(bm_delete)(bm2);
+  DRD_(bm_delete)(bm1);
+}
+
 int main(int argc, char** argv)
 {
   int outer_loop_step = ADDR_GRANULARITY;
@@ -352,6 +406,7 @@ int main(int argc, char** argv)
   bm_test1();
   bm_test2();
   bm_test3(outer_loop_step, inner_loop_step);
+  bm_test4(inner_loop_step);
   DRD_(bm_module_cleanup)();
 
   fprintf(stderr, "End of DRD BM unit test.\n");
@@ -0,0 +1,162 @@
+/**
+ * @brief Microbenchmark for the segment merge and race detection kernels of
+ * DRD's bitmap implementation.
+ *
+ * Usage: unit_bitmap_perf [-n <nr_bitmaps>] [-p <pages_per_bitmap>]
+ *                         [-l <nr_loops>]
+ *
+ * Runs natively (not under Valgrind): a number of bitmaps, each with
+ * accesses spread over a number of second level bitmaps, are merged into
+ * one bitmap and tested for races against each other, the way DRD does
+ * when it merges segments.
+ */
+
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "coregrind/m_xarray.c"
+#include "coregrind/m_poolalloc.c"
+#include "coregrind/m_oset.c"
+#include "drd/drd_bitmap.c"
+#include "drd/pub_drd_bitmap.h"
+
+
+/* Replacements for Valgrind core functionality. */
+
+void* VG_(malloc)(const HChar* cc, SizeT nbytes)
+{ return malloc(nbytes); }
+void  VG_(free)(void* p)
+{ return free(p); }
+void  VG_(assert_fail)(Bool isCore, const HChar* assertion, const HChar* file,
+                       Int line, const HChar* function, const HChar* format,
+                       ...)
+{
+  fprintf(stderr, "%s:%u: %s%sAssertion `%s' failed.\n", file, line,
+          function ? (char*)function : "", function ? ": " : "", assertion);
+  abort();
+}
+
+Int VG_(strcmp)( const HChar* s1, const HChar* s2 )
+{ return strcmp(s1, s2); }
+void* VG_(memset)(void *s, Int c, SizeT sz)
+{ return memset(s, c, sz); }
+void* VG_(memcpy)(void *d, const void *s, SizeT sz)
+{ return memcpy(d, s, sz); }
+void* VG_(memmove)(void *d, const void *s, SizeT sz)
+{ return memmove(d, s, sz); }
+Int VG_(memcmp)(const void* s1, const void* s2, SizeT n)
+{ return memcmp(s1, s2, n); }
+UInt VG_(printf)(const HChar *format, ...)
+{ UInt ret; va_list vargs; va_start(vargs, format); ret = vprintf(format, vargs); va_end(vargs); return ret; }
+UInt VG_(message)(VgMsgKind kind, const HChar* format, ...)
+{ UInt ret; va_list vargs; va_start(vargs, format); ret = vprintf(format, vargs); va_end(vargs); printf("\n"); return ret; }
+Bool DRD_(is_suppressed)(const Addr a1, const Addr a2)
+{ return False; }
+void VG_(vcbprintf)(void(*char_sink)(HChar, void* opaque),
+                    void* opaque,
+                    const HChar* format, va_list vargs)
+{ assert(0); }
+void VG_(ssort)( void* base, SizeT nmemb, SizeT size,
+                 Int (*compar)(const void*, const void*) )
+{ assert(0); }
+
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv)
+{
+  int nr_bitmaps = 16;
+  int pages = 256;
+  int loops = 200;
+  struct bitmap** bm;
+  double t, t_merge = 0, t_races = 0;
+  ULong merges, races = 0;
+  int optchar, i, j, l;
+
+  while ((optchar = getopt(argc, argv, "n:p:l:")) != EOF)
+  {
+    switch (optchar)
+    {
+    case 'n':
+      nr_bitmaps = atoi(optarg);
+      break;
+    case 'p':
+      pages = atoi(optarg);
+      break;
+    case 'l':
+      loops = atoi(optarg);
+      break;
+    default:
+      fprintf(stderr,
+              "Usage: %s [-n <nr_bitmaps>] [-p <pages_per_bitmap>]"
+              " [-l <nr_loops>].\n", argv[0]);
+      return 1;
+    }
+  }
+  assert(nr_bitmaps >= 2 && pages >= 1 && loops >= 1);
+
+  DRD_(bm_module_init)();
+
+  /*
+   * Every bitmap loads every 8th word of its pages and bitmap i stores to
+   * the word after the i-th load, such that there are no races and hence
+   * DRD_(bm_has_races)() has to look at all the second level bitmaps.
+   */
+  bm = malloc(nr_bitmaps * sizeof(bm[0]));
+  for (i = 0; i < nr_bitmaps; i++)
+  {
+    bm[i] = DRD_(bm_new)();
+    for (j = 0; j < pages; j++)
+    {
+      const Addr base = make_address(j + 16, 0);
+      Addr a;
+
+      for (a = base; a < make_address(j + 17, 0); a += 64)
+        DRD_(bm_access_load_8)(bm[i], a);
+      DRD_(bm_access_store_8)(bm[i], base + 64 * (i % 64) + 8);
+    }
+  }
+
+  for (l = 0; l < loops; l++)
+  {
+    struct bitmap* merged = DRD_(bm_new)();
+
+    t = now();
+    for (i = 0; i < nr_bitmaps; i++)
+      DRD_(bm_merge2)(merged, bm[i]);
+    t_merge += now() - t;
+
+    t = now();
+    for (i = 1; i < nr_bitmaps; i++)
+      races += DRD_(bm_has_races)(bm[0], bm[i]);
+    t_races += now() - t;
+
+    DRD_(bm_delete)(merged);
+  }
+
+  merges = (ULong)loops * nr_bitmaps * pages;
+  printf("bitmap2 merges: %llu in %.3f s (%.1f ns per merge, %.0f MB/s)\n",
+         merges, t_merge, t_merge * 1e9 / merges,
+         merges * sizeof(struct bitmap1) / t_merge / 1e6);
+  printf("bitmap2 race tests: %llu in %.3f s (%.1f ns per test), %llu races\n",
+         (ULong)loops * (nr_bitmaps - 1) * pages, t_races,
+         t_races * 1e9 / ((ULong)loops * (nr_bitmaps - 1) * pages), races);
+
+  for (i = 0; i < nr_bitmaps; i++)
+    DRD_(bm_delete)(bm[i]);
+  free(bm);
+  DRD_(bm_module_cleanup)();
+
+  return 0;
+}
@@ -93,6 +93,14 @@ static void vc_unittest(void)
   fprintf(stderr, ") = %d sw %d\n",
           DRD_(vc_lte)(&vc4, &vc5), DRD_(vc_lte)(&vc5, &vc4));
 
+  assert(DRD_(vc_get)(&vc3, 1) == 4);
+  assert(DRD_(vc_get)(&vc3, 3) == 9);
+  assert(DRD_(vc_get)(&vc3, 5) == 8);
+  assert(DRD_(vc_get)(&vc3, 0) == 0);
+  assert(DRD_(vc_get)(&vc3, 4) == 0);
+  assert(DRD_(vc_get)(&vc3, 6) == 0);
+  assert(DRD_(vc_get)(&vc5, 1) == 4);
+
   for (i = 0; i < 64; i++)
     DRD_(vc_reserve)(&vc1, i);
   for (i = 64; i > 0; i--)
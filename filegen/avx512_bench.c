@@ -0,0 +1,142 @@
+/*
+   This file is part of Valgrind, a dynamic binary instrumentation
+   framework.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, see <http://www.gnu.org/licenses/>.
+
+   The GNU General Public License is contained in the file COPYING.
+*/
+
+/* Runs every AVX-512 instruction form generated by filegen into
+   avx512_forms.h, and prints the time it takes per instruction.
+   avx512_bench.sh runs it natively and under Valgrind tools to get the
+   slowdown of each form.
+
+   The code of each form is UNROLL copies of the instruction followed by
+   a ret, and is called with rdi pointing to a scratch buffer.  It is
+   placed in a file-backed mapping so that Valgrind does not have to
+   check it for self-modification, which would distort the timings.
+   Forms the CPU (or Valgrind) does not support raise SIGILL, and are
+   reported as such.
+
+   usage: avx512_bench [iterations [first form]] */
+
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+struct avx512_form {
+   const char* name;
+   const char* form;
+   const char* class;
+   int len;
+   unsigned char bytes[16];
+};
+
+#include "avx512_forms.h"
+
+#define N_FORMS (sizeof(FORMS) / sizeof(FORMS[0]))
+#define UNROLL  16
+#define SLOT    256
+#define REPEAT  5
+
+static sigjmp_buf env;
+
+static void on_signal(int sig)
+{
+   siglongjmp(env, sig);
+}
+
+static double now_ns(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char** argv)
+{
+   int iters = argc > 1 ? atoi(argv[1]) : 1000;
+   unsigned first = argc > 2 ? atoi(argv[2]) : 0;
+   static unsigned char slot[SLOT];
+   static unsigned char scratch[4096] __attribute__((aligned(64)));
+   char path[] = "/tmp/avx512_bench.XXXXXX";
+   int fd = mkstemp(path);
+   unsigned i;
+
+   if (fd < 0) {
+      perror("mkstemp");
+      return 1;
+   }
+   unlink(path);
+   for (i = 0; i < N_FORMS; i++) {
+      int j, n = 0;
+      for (j = 0; j < UNROLL; j++) {
+         memcpy(slot + n, FORMS[i].bytes, FORMS[i].len);
+         n += FORMS[i].len;
+      }
+      slot[n++] = 0xc3; /* ret */
+      memset(slot + n, 0xcc, SLOT - n);
+      if (write(fd, slot, SLOT) != SLOT) {
+         perror("write");
+         return 1;
+      }
+   }
+   unsigned char* code = mmap(NULL, N_FORMS * SLOT, PROT_READ | PROT_EXEC,
+                              MAP_PRIVATE, fd, 0);
+   if (code == MAP_FAILED) {
+      perror("mmap");
+      return 1;
+   }
+
+   struct sigaction sa;
+   memset(&sa, 0, sizeof(sa));
+   sa.sa_handler = on_signal;
+   sa.sa_flags = SA_NODEFER;
+   sigaction(SIGILL, &sa, NULL);
+   sigaction(SIGSEGV, &sa, NULL);
+   sigaction(SIGBUS, &sa, NULL);
+
+   for (i = first; i < N_FORMS; i++) {
+      void (*fn)(void*) = (void (*)(void*))(code + i * SLOT);
+      volatile double best = 0;
+      int sig, k, r;
+
+      printf("%u\t%s\t%s\t%s\t", i, FORMS[i].name, FORMS[i].form,
+             FORMS[i].class);
+      fflush(stdout);
+      if ((sig = sigsetjmp(env, 1)) != 0) {
+         printf("%s\n", sig == SIGILL ? "sigill" : "fault");
+         continue;
+      }
+      /* The first call also translates the code under Valgrind. */
+      fn(scratch);
+      /* Keep the fastest of a few runs, to filter out interruptions. */
+      for (r = 0; r < REPEAT; r++) {
+         double t0 = now_ns();
+         for (k = 0; k < iters; k++)
+            fn(scratch);
+         double t = now_ns() - t0;
+         if (r == 0 || t < best)
+            best = t;
+      }
+      printf("%.3f\n", best / ((double)iters * UNROLL));
+   }
+   return 0;
+}
@@ -0,0 +1,69 @@
+#!/bin/sh
+
+# Measure the slowdown of every AVX-512 instruction form under Nulgrind
+# and Memcheck.  Run ./filegen.sh first to generate avx512_forms.h.
+#
+# usage: ./avx512_bench.sh [iterations]
+# The valgrind to use can be set with VALGRIND (default ../vg-in-place).
+
+VALGRIND=${VALGRIND:-../vg-in-place}
+ITERS=${1:-1000}
+
+gcc -O2 -o avx512_bench avx512_bench.c || exit 1
+
+# Run the benchmark, appending to file $1.  If the run aborts (a form that
+# Valgrind cannot translate), the form is recorded as "crash" and the run
+# is restarted from the next form.
+run () {
+   out=$1; shift
+   : > $out
+   first=0
+   until "$@" ./avx512_bench $ITERS $first >> $out 2> /dev/null; do
+      last=$(tail -n 1 $out | cut -f1)
+      if [ -z "$last" ] || [ "$last" -lt "$first" ]; then
+         echo "$* aborted before running any form" >&2
+         exit 1
+      fi
+      echo crash >> $out
+      first=$((last + 1))
+   done
+}
+
+run avx512_bench.native
+run avx512_bench.none     $VALGRIND -q --tool=none
+run avx512_bench.memcheck $VALGRIND -q --tool=memcheck
+
+# Join the three runs on the form index; columns are native ns per
+# instruction, then slowdown under none and memcheck.  Forms that raise
+# SIGILL natively (not supported by this CPU) or made Valgrind crash have
+# no slowdown.
+awk -F'\t' '
+   FILENAME == ARGV[1] { native[$1] = $NF; next }
+   FILENAME == ARGV[2] { none[$1] = $NF; next }
+   {
+      n = native[$1]; a = none[$1]; m = $NF
+      if (n + 0 > 0 && a + 0 > 0 && m + 0 > 0)
+         printf "%s\t%s\t%s\t%.3f\t%.1f\t%.1f\n", $2, $3, $4, n, a / n, m / n
+      else
+         printf "%s\t%s\t%s\t%s\t%s\t%s\n", $2, $3, $4, n, a, m
+   }' avx512_bench.native avx512_bench.none avx512_bench.memcheck \
+   > avx512_bench.txt
+
+printf "name\tform\tclass\tnative_ns\tnone\tmemcheck\n"
+sort -t"$(printf '\t')" -k6 -g -r avx512_bench.txt
+
+# Summary per translation class: number of forms measured and the
+# geometric mean of their slowdowns.
+echo
+awk -F'\t' '
+   $5 + 0 > 0 && $6 + 0 > 0 {
+      n[$3]++; none[$3] += log($5); mc[$3] += log($6)
+   }
+   $5 + 0 == 0 || $6 + 0 == 0 { skipped[$3]++ }
+   END {
+      printf "%-12s %6s %8s %14s %18s\n", "class", "forms", "skipped",
+             "none (geomean)", "memcheck (geomean)"
+      for (c in n)
+         printf "%-12s %6d %8d %14.1f %18.1f\n", c, n[c], skipped[c],
+                exp(none[c] / n[c]), exp(mc[c] / n[c])
+   }' avx512_bench.txt
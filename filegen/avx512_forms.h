@@ -0,0 +1,1467 @@
+/* This file is auto-generated by "filegen" script */
+/* DO NOT MODIFY */
+
+/* name | form | translation class | encoding length | encoding */
+static const struct avx512_form FORMS[] = {
+	{"VPSHUFB", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x6d,0x08,0x00,0xc8}},
+	{"VPSHUFB", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x6d,0x28,0x00,0xc8}},
+	{"VPSHUFB", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x6d,0x48,0x00,0xc8}},
+	{"VPERMQ", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x28,0x00,0xc8,0x01}},
+	{"VPERMQ", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x00,0xc8,0x01}},
+	{"VPERMPD", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x28,0x01,0xc8,0x01}},
+	{"VPERMPD", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x01,0xc8,0x01}},
+	{"VALIGND", "xmm, xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x08,0x03,0xc8,0x01}},
+	{"VALIGND", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x03,0xc8,0x01}},
+	{"VALIGND", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x03,0xc8,0x01}},
+	{"VALIGNQ", "xmm, xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x08,0x03,0xc8,0x01}},
+	{"VALIGNQ", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x28,0x03,0xc8,0x01}},
+	{"VALIGNQ", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x03,0xc8,0x01}},
+	{"VPMADDUBSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x04,0xc8}},
+	{"VPMADDUBSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x04,0xc8}},
+	{"VPMADDUBSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x04,0xc8}},
+	{"VPERMILPS", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x08,0x04,0xc8,0x01}},
+	{"VPERMILPS", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x28,0x04,0xc8,0x01}},
+	{"VPERMILPS", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x48,0x04,0xc8,0x01}},
+	{"VPERMILPD", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x08,0x05,0xc8,0x01}},
+	{"VPERMILPD", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x28,0x05,0xc8,0x01}},
+	{"VPERMILPD", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x05,0xc8,0x01}},
+	{"VRNDSCALEPS", "xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x7d,0x08,0x08,0xc8,0x01}},
+	{"VRNDSCALEPS", "ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x7d,0x28,0x08,0xc8,0x01}},
+	{"VRNDSCALEPS", "zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x7d,0x48,0x08,0xc8,0x01}},
+	{"VRNDSCALEPD", "xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xfd,0x08,0x09,0xc8,0x01}},
+	{"VRNDSCALEPD", "ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xfd,0x28,0x09,0xc8,0x01}},
+	{"VRNDSCALEPD", "zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xfd,0x48,0x09,0xc8,0x01}},
+	{"VRNDSCALESS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x0a,0xc8,0x01}},
+	{"VRNDSCALESD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x0b,0xc8,0x01}},
+	{"VPMULHRSW", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x6d,0x08,0x0b,0xc8}},
+	{"VPMULHRSW", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x6d,0x28,0x0b,0xc8}},
+	{"VPMULHRSW", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x6d,0x48,0x0b,0xc8}},
+	{"VPERMILPS", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x6d,0x08,0x0c,0xc8}},
+	{"VPERMILPS", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x6d,0x28,0x0c,0xc8}},
+	{"VPERMILPS", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x6d,0x48,0x0c,0xc8}},
+	{"VPERMILPD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xed,0x08,0x0d,0xc8}},
+	{"VPERMILPD", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xed,0x28,0x0d,0xc8}},
+	{"VPERMILPD", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xed,0x48,0x0d,0xc8}},
+	{"VPALIGNR", "xmm, xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x08,0x0f,0xc8,0x01}},
+	{"VPALIGNR", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x0f,0xc8,0x01}},
+	{"VPALIGNR", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x0f,0xc8,0x01}},
+	{"VMOVUPS", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x10,0xc8}},
+	{"VMOVUPS", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x10,0xc8}},
+	{"VMOVUPS", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x10,0xc8}},
+	{"VMOVUPD", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x10,0xc8}},
+	{"VMOVUPD", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x10,0xc8}},
+	{"VMOVUPD", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x10,0xc8}},
+	{"VPSRLVW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x10,0xc8}},
+	{"VPSRLVW", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x10,0xc8}},
+	{"VPSRLVW", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x10,0xc8}},
+	{"VMOVSD", "xmm, m64", "manual", 6, {0x62,0xf1,0xff,0x08,0x10,0x0f}},
+	{"VMOVSD", "xmm, xmm, xmm", "manual", 6, {0x62,0xf1,0xef,0x08,0x10,0xc8}},
+	{"VMOVSS", "xmm, m32", "manual", 6, {0x62,0xf1,0x7e,0x08,0x10,0x0f}},
+	{"VMOVSS", "xmm, xmm, xmm", "manual", 6, {0x62,0xf1,0x6e,0x08,0x10,0xc8}},
+	{"VPMOVUSWB", "xmm/m64, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x10,0xc8}},
+	{"VPMOVUSWB", "xmm/m128, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x10,0xc8}},
+	{"VPMOVUSWB", "ymm/m256, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x10,0xc8}},
+	{"VMOVUPS", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x11,0xc8}},
+	{"VMOVUPS", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x11,0xc8}},
+	{"VMOVUPS", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x11,0xc8}},
+	{"VMOVUPD", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x11,0xc8}},
+	{"VMOVUPD", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x11,0xc8}},
+	{"VMOVUPD", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x11,0xc8}},
+	{"VMOVSD", "m64, xmm", "manual", 6, {0x62,0xf1,0xff,0x08,0x11,0x0f}},
+	{"VMOVSD", "xmm, xmm, xmm", "manual", 6, {0x62,0xf1,0xef,0x08,0x11,0xc8}},
+	{"VMOVSS", "m32, xmm", "manual", 6, {0x62,0xf1,0x7e,0x08,0x11,0x0f}},
+	{"VMOVSS", "xmm, xmm, xmm", "manual", 6, {0x62,0xf1,0x6e,0x08,0x11,0xc8}},
+	{"VPSRAVW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x11,0xc8}},
+	{"VPSRAVW", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x11,0xc8}},
+	{"VPSRAVW", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x11,0xc8}},
+	{"VPMOVUSDB", "xmm/m32, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x11,0xc8}},
+	{"VPMOVUSDB", "xmm/m64, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x11,0xc8}},
+	{"VPMOVUSDB", "xmm/m128, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x11,0xc8}},
+	{"VMOVHLPS", "xmm, xmm, xmm", "manual", 6, {0x62,0xf1,0x6c,0x08,0x12,0xc8}},
+	{"VMOVLPS", "m64, xmm", "manual", 6, {0x62,0xf1,0x7c,0x08,0x12,0x0f}},
+	{"VMOVLPD", "xmm, xmm, m64", "native", 6, {0x62,0xf1,0xed,0x08,0x12,0x0f}},
+	{"VPSLLVW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x12,0xc8}},
+	{"VPSLLVW", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x12,0xc8}},
+	{"VPSLLVW", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x12,0xc8}},
+	{"VMOVDDUP", "xmm, xmm/m128, xmm/m128", "native", 6, {0x62,0xf1,0xff,0x08,0x12,0xc8}},
+	{"VMOVDDUP", "ymm, ymm/m256, ymm/m256", "native", 6, {0x62,0xf1,0xff,0x28,0x12,0xc8}},
+	{"VMOVDDUP", "zmm, zmm/m512, zmm/m512", "native", 6, {0x62,0xf1,0xff,0x48,0x12,0xc8}},
+	{"VMOVSLDUP", "xmm, xmm/m128, xmm/m128", "native", 6, {0x62,0xf1,0x7e,0x08,0x12,0xc8}},
+	{"VMOVSLDUP", "ymm, ymm/m256, ymm/m256", "native", 6, {0x62,0xf1,0x7e,0x28,0x12,0xc8}},
+	{"VMOVSLDUP", "zmm, zmm/m512, zmm/m512", "native", 6, {0x62,0xf1,0x7e,0x48,0x12,0xc8}},
+	{"VPMOVUSQB", "xmm/m16, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x12,0xc8}},
+	{"VPMOVUSQB", "xmm/m32, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x12,0xc8}},
+	{"VPMOVUSQB", "xmm/m64, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x12,0xc8}},
+	{"VMOVLPS", "m64, xmm", "native", 6, {0x62,0xf1,0x7c,0x08,0x13,0x0f}},
+	{"VMOVLPD", "m64, xmm", "native", 6, {0x62,0xf1,0xfd,0x08,0x13,0x0f}},
+	{"VCVTPH2PS", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x13,0xc8}},
+	{"VCVTPH2PS", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x13,0xc8}},
+	{"VCVTPH2PS", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x13,0xc8}},
+	{"VPMOVUSDW", "xmm/m64, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x13,0xc8}},
+	{"VPMOVUSDW", "xmm/m128, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x13,0xc8}},
+	{"VPMOVUSDW", "ymm/m256, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x13,0xc8}},
+	{"VUNPCKLPS", "xmm, xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x6c,0x08,0x14,0xc8}},
+	{"VUNPCKLPS", "ymm, ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x6c,0x28,0x14,0xc8}},
+	{"VUNPCKLPS", "zmm, zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x6c,0x48,0x14,0xc8}},
+	{"VUNPCKLPD", "xmm, xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xed,0x08,0x14,0xc8}},
+	{"VUNPCKLPD", "ymm, ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xed,0x28,0x14,0xc8}},
+	{"VUNPCKLPD", "zmm, zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xed,0x48,0x14,0xc8}},
+	{"VPEXTRB", "r/m8, xmm, imm8", "manual", 7, {0x62,0xf3,0x7d,0x08,0x14,0xc8,0x01}},
+	{"VPRORVD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x6d,0x08,0x14,0xc8}},
+	{"VPRORVD", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x6d,0x28,0x14,0xc8}},
+	{"VPRORVD", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x6d,0x48,0x14,0xc8}},
+	{"VPRORVQ", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xed,0x08,0x14,0xc8}},
+	{"VPRORVQ", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xed,0x28,0x14,0xc8}},
+	{"VPRORVQ", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xed,0x48,0x14,0xc8}},
+	{"VPMOVUSQW", "xmm/m32, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x14,0xc8}},
+	{"VPMOVUSQW", "xmm/m64, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x14,0xc8}},
+	{"VPMOVUSQW", "xmm/m128, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x14,0xc8}},
+	{"VPEXTRW", "r/m16, xmm, imm8", "manual", 7, {0x62,0xf3,0x7d,0x08,0x15,0xc8,0x01}},
+	{"VUNPCKHPS", "xmm, xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x6c,0x08,0x15,0xc8}},
+	{"VUNPCKHPS", "ymm, ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x6c,0x28,0x15,0xc8}},
+	{"VUNPCKHPS", "zmm, zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x6c,0x48,0x15,0xc8}},
+	{"VUNPCKHPD", "xmm, xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xed,0x08,0x15,0xc8}},
+	{"VUNPCKHPD", "ymm, ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xed,0x28,0x15,0xc8}},
+	{"VUNPCKHPD", "zmm, zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xed,0x48,0x15,0xc8}},
+	{"VPROLVD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x6d,0x08,0x15,0xc8}},
+	{"VPROLVD", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x6d,0x28,0x15,0xc8}},
+	{"VPROLVD", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x6d,0x48,0x15,0xc8}},
+	{"VPROLVQ", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xed,0x08,0x15,0xc8}},
+	{"VPROLVQ", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xed,0x28,0x15,0xc8}},
+	{"VPROLVQ", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xed,0x48,0x15,0xc8}},
+	{"VPMOVUSQD", "xmm/m64, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x15,0xc8}},
+	{"VPMOVUSQD", "xmm/m128, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x15,0xc8}},
+	{"VPMOVUSQD", "ymm/m256, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x15,0xc8}},
+	{"VMOVLHPS", "xmm, xmm, xmm", "manual", 6, {0x62,0xf1,0x6c,0x08,0x16,0xc8}},
+	{"VMOVHPS", "xmm, xmm, m64", "manual", 6, {0x62,0xf1,0x6c,0x08,0x16,0x0f}},
+	{"VMOVHPD", "xmm, m64, xmm", "native", 6, {0x62,0xf1,0xed,0x08,0x16,0x0f}},
+	{"VPERMPS", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf2,0x6d,0x28,0x16,0xc8}},
+	{"VPERMPS", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x16,0xc8}},
+	{"VPERMPD", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x16,0xc8}},
+	{"VPERMPD", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x16,0xc8}},
+	{"VPEXTRD", "r/m32, xmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x08,0x16,0xc8,0x01}},
+	{"VPEXTRQ", "r/m64, xmm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x08,0x16,0xc8,0x01}},
+	{"VMOVSHDUP", "xmm, xmm/m128, xmm/m128", "native", 6, {0x62,0xf1,0x7e,0x08,0x16,0xc8}},
+	{"VMOVSHDUP", "ymm, ymm/m256, ymm/m256", "native", 6, {0x62,0xf1,0x7e,0x28,0x16,0xc8}},
+	{"VMOVSHDUP", "zmm, zmm/m512, zmm/m512", "native", 6, {0x62,0xf1,0x7e,0x48,0x16,0xc8}},
+	{"VMOVHPS", "m64, xmm", "native", 6, {0x62,0xf1,0x7c,0x08,0x17,0x0f}},
+	{"VMOVHPD", "m64, xmm", "native", 6, {0x62,0xf1,0xfd,0x08,0x17,0x0f}},
+	{"VEXTRACTPS", "r/m32, xmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x08,0x17,0xc8,0x01}},
+	{"VBROADCASTSS", "xmm, xmm/m32", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x18,0xc8}},
+	{"VBROADCASTSS", "ymm, xmm/m32", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x18,0xc8}},
+	{"VBROADCASTSS", "zmm, xmm/m32", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x18,0xc8}},
+	{"VINSERTF32x4", "ymm, ymm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x18,0xc8,0x01}},
+	{"VINSERTF32x4", "zmm, zmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x18,0xc8,0x01}},
+	{"VINSERTF64x2", "ymm, ymm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x28,0x18,0xc8,0x01}},
+	{"VINSERTF64x2", "zmm, zmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x18,0xc8,0x01}},
+	{"VBROADCASTF32x2", "ymm, m64", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x19,0x0f}},
+	{"VBROADCASTF32x2", "zmm, m64", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x19,0x0f}},
+	{"VBROADCASTSD", "ymm, xmm/m64", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x19,0xc8}},
+	{"VBROADCASTSD", "zmm, xmm/m64", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x19,0xc8}},
+	{"VEXTRACTF32x4", "xmm/m128, ymm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x28,0x19,0xc8,0x01}},
+	{"VEXTRACTF32x4", "xmm/m128, zmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x48,0x19,0xc8,0x01}},
+	{"VEXTRACTF64x2", "xmm/m128, ymm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x28,0x19,0xc8,0x01}},
+	{"VEXTRACTF64x2", "xmm/m128, zmm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x19,0xc8,0x01}},
+	{"VBROADCASTF32x4", "ymm, m128", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x1a,0x0f}},
+	{"VBROADCASTF32x4", "zmm, m128", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x1a,0x0f}},
+	{"VBROADCASTF64x2", "ymm, m128", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x1a,0x0f}},
+	{"VBROADCASTF64x2", "zmm, m128", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x1a,0x0f}},
+	{"VINSERTF32x8", "zmm, zmm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x1a,0xc8,0x01}},
+	{"VINSERTF64x4", "zmm, zmm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x1a,0xc8,0x01}},
+	{"VBROADCASTF32x8", "zmm, m256", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x1b,0x0f}},
+	{"VBROADCASTF64x4", "zmm, m256", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x1b,0x0f}},
+	{"VEXTRACTF32x8", "ymm/m256, zmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x48,0x1b,0xc8,0x01}},
+	{"VEXTRACTF64x4", "ymm/m256, zmm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x1b,0xc8,0x01}},
+	{"VPABSB", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x1c,0xc8}},
+	{"VPABSB", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x1c,0xc8}},
+	{"VPABSB", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x1c,0xc8}},
+	{"VPABSW", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x1d,0xc8}},
+	{"VPABSW", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x1d,0xc8}},
+	{"VPABSW", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x1d,0xc8}},
+	{"VCVTPS2PH", "xmm/m64, xmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x08,0x1d,0xc8,0x01}},
+	{"VCVTPS2PH", "xmm/m128, ymm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x28,0x1d,0xc8,0x01}},
+	{"VCVTPS2PH", "ymm/m256, zmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x48,0x1d,0xc8,0x01}},
+	{"VPABSD", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x1e,0xc8}},
+	{"VPABSD", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x1e,0xc8}},
+	{"VPABSD", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x1e,0xc8}},
+	{"VPCMPUD", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x1e,0xc8,0x01}},
+	{"VPCMPUD", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x1e,0xc8,0x01}},
+	{"VPCMPUD", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x1e,0xc8,0x01}},
+	{"VPCMPUQ", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x1e,0xc8,0x01}},
+	{"VPCMPUQ", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x1e,0xc8,0x01}},
+	{"VPCMPUQ", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x1e,0xc8,0x01}},
+	{"VPABSQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xfd,0x08,0x1f,0xc8}},
+	{"VPABSQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x1f,0xc8}},
+	{"VPABSQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x1f,0xc8}},
+	{"VPCMPD", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x1f,0xc8,0x01}},
+	{"VPCMPD", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x1f,0xc8,0x01}},
+	{"VPCMPD", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x1f,0xc8,0x01}},
+	{"VPCMPQ", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x1f,0xc8,0x01}},
+	{"VPCMPQ", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x1f,0xc8,0x01}},
+	{"VPCMPQ", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x1f,0xc8,0x01}},
+	{"VPMOVSXBW", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x20,0xc8}},
+	{"VPMOVSXBW", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x20,0xc8}},
+	{"VPMOVSXBW", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x20,0xc8}},
+	{"VPMOVSWB", "xmm/m64, xmm", "helper", 6, {0x62,0xf2,0x7e,0x08,0x20,0xc8}},
+	{"VPMOVSWB", "xmm/m128, ymm", "helper", 6, {0x62,0xf2,0x7e,0x28,0x20,0xc8}},
+	{"VPMOVSWB", "ymm/m256, zmm", "helper", 6, {0x62,0xf2,0x7e,0x48,0x20,0xc8}},
+	{"VPINSRB", "xmm, xmm, r/m8, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x08,0x20,0xc8,0x01}},
+	{"VPMOVSXBD", "xmm, xmm/m32", "native", 6, {0x62,0xf2,0x7d,0x08,0x21,0xc8}},
+	{"VPMOVSXBD", "ymm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x28,0x21,0xc8}},
+	{"VPMOVSXBD", "zmm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x48,0x21,0xc8}},
+	{"VINSERTPS", "xmm, xmm, xmm/m32, imm8", "manual", 7, {0x62,0xf3,0x6d,0x08,0x21,0xc8,0x01}},
+	{"VPMOVSDB", "xmm/m32, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x21,0xc8}},
+	{"VPMOVSDB", "xmm/m64, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x21,0xc8}},
+	{"VPMOVSDB", "xmm/m128, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x21,0xc8}},
+	{"VPMOVSXBQ", "xmm, xmm/m16", "native", 6, {0x62,0xf2,0x7d,0x08,0x22,0xc8}},
+	{"VPMOVSXBQ", "ymm, xmm/m32", "native", 6, {0x62,0xf2,0x7d,0x28,0x22,0xc8}},
+	{"VPMOVSXBQ", "zmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x48,0x22,0xc8}},
+	{"VPMOVSQB", "xmm/m16, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x22,0xc8}},
+	{"VPMOVSQB", "xmm/m32, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x22,0xc8}},
+	{"VPMOVSQB", "xmm/m64, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x22,0xc8}},
+	{"VPINSRD", "xmm, xmm, r/m32, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x08,0x22,0xc8,0x01}},
+	{"VPINSRQ", "xmm, xmm, r/m64, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x08,0x22,0xc8,0x01}},
+	{"VPMOVSXWD", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x23,0xc8}},
+	{"VPMOVSXWD", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x23,0xc8}},
+	{"VPMOVSXWD", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x23,0xc8}},
+	{"VSHUFF32x4", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x23,0xc8,0x01}},
+	{"VSHUFF32x4", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x23,0xc8,0x01}},
+	{"VSHUFF64x2", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x28,0x23,0xc8,0x01}},
+	{"VSHUFF64x2", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x23,0xc8,0x01}},
+	{"VPMOVSDW", "xmm/m64, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x23,0xc8}},
+	{"VPMOVSDW", "xmm/m128, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x23,0xc8}},
+	{"VPMOVSDW", "ymm/m256, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x23,0xc8}},
+	{"VPMOVSXWQ", "xmm, xmm/m32", "native", 6, {0x62,0xf2,0x7d,0x08,0x24,0xc8}},
+	{"VPMOVSXWQ", "ymm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x28,0x24,0xc8}},
+	{"VPMOVSXWQ", "zmm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x48,0x24,0xc8}},
+	{"VPMOVSQW", "xmm/m32, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x24,0xc8}},
+	{"VPMOVSQW", "xmm/m64, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x24,0xc8}},
+	{"VPMOVSQW", "xmm/m128, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x24,0xc8}},
+	{"VPTERNLOGD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x25,0xc8,0x01}},
+	{"VPTERNLOGD", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x25,0xc8,0x01}},
+	{"VPTERNLOGD", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x25,0xc8,0x01}},
+	{"VPTERNLOGQ", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x25,0xc8,0x01}},
+	{"VPTERNLOGQ", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x25,0xc8,0x01}},
+	{"VPTERNLOGQ", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x25,0xc8,0x01}},
+	{"VPMOVSXDQ", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x25,0xc8}},
+	{"VPMOVSXDQ", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x25,0xc8}},
+	{"VPMOVSXDQ", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x25,0xc8}},
+	{"VPMOVSQD", "xmm/m64, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x25,0xc8}},
+	{"VPMOVSQD", "xmm/m128, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x25,0xc8}},
+	{"VPMOVSQD", "ymm/m256, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x25,0xc8}},
+	{"VPTESTMB", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x26,0xc8}},
+	{"VPTESTMB", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x26,0xc8}},
+	{"VPTESTMB", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x26,0xc8}},
+	{"VPTESTMW", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x26,0xc8}},
+	{"VPTESTMW", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x26,0xc8}},
+	{"VPTESTMW", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x26,0xc8}},
+	{"VGETMANTPS", "xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x7d,0x08,0x26,0xc8,0x01}},
+	{"VGETMANTPS", "ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x7d,0x28,0x26,0xc8,0x01}},
+	{"VGETMANTPS", "zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x7d,0x48,0x26,0xc8,0x01}},
+	{"VGETMANTPD", "xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xfd,0x08,0x26,0xc8,0x01}},
+	{"VGETMANTPD", "ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xfd,0x28,0x26,0xc8,0x01}},
+	{"VGETMANTPD", "zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xfd,0x48,0x26,0xc8,0x01}},
+	{"VPTESTNMB", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6e,0x08,0x26,0xc8}},
+	{"VPTESTNMB", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6e,0x28,0x26,0xc8}},
+	{"VPTESTNMB", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6e,0x48,0x26,0xc8}},
+	{"VPTESTNMW", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xee,0x08,0x26,0xc8}},
+	{"VPTESTNMW", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xee,0x28,0x26,0xc8}},
+	{"VPTESTNMW", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xee,0x48,0x26,0xc8}},
+	{"VPTESTMD", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x27,0xc8}},
+	{"VPTESTMD", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x27,0xc8}},
+	{"VPTESTMD", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x27,0xc8}},
+	{"VPTESTMQ", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x27,0xc8}},
+	{"VPTESTMQ", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x27,0xc8}},
+	{"VPTESTMQ", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x27,0xc8}},
+	{"VGETMANTSS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x27,0xc8,0x01}},
+	{"VGETMANTSD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x27,0xc8,0x01}},
+	{"VPTESTNMD", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6e,0x08,0x27,0xc8}},
+	{"VPTESTNMD", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6e,0x28,0x27,0xc8}},
+	{"VPTESTNMD", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6e,0x48,0x27,0xc8}},
+	{"VPTESTNMQ", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xee,0x08,0x27,0xc8}},
+	{"VPTESTNMQ", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xee,0x28,0x27,0xc8}},
+	{"VPTESTNMQ", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xee,0x48,0x27,0xc8}},
+	{"VMOVAPS", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x28,0xc8}},
+	{"VMOVAPS", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x28,0xc8}},
+	{"VMOVAPS", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x28,0xc8}},
+	{"VMOVAPD", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x28,0xc8}},
+	{"VMOVAPD", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x28,0xc8}},
+	{"VMOVAPD", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x28,0xc8}},
+	{"VPMULDQ", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xed,0x08,0x28,0xc8}},
+	{"VPMULDQ", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xed,0x28,0x28,0xc8}},
+	{"VPMULDQ", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xed,0x48,0x28,0xc8}},
+	{"VPMOVM2B", "xmm, k", "helper", 6, {0x62,0xf2,0x7e,0x08,0x28,0xc8}},
+	{"VPMOVM2B", "ymm, k", "helper", 6, {0x62,0xf2,0x7e,0x28,0x28,0xc8}},
+	{"VPMOVM2B", "zmm, k", "helper", 6, {0x62,0xf2,0x7e,0x48,0x28,0xc8}},
+	{"VPMOVM2W", "xmm, k", "helper", 6, {0x62,0xf2,0xfe,0x08,0x28,0xc8}},
+	{"VPMOVM2W", "ymm, k", "helper", 6, {0x62,0xf2,0xfe,0x28,0x28,0xc8}},
+	{"VPMOVM2W", "zmm, k", "helper", 6, {0x62,0xf2,0xfe,0x48,0x28,0xc8}},
+	{"VMOVAPS", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x29,0xc8}},
+	{"VMOVAPS", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x29,0xc8}},
+	{"VMOVAPS", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x29,0xc8}},
+	{"VMOVAPD", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x29,0xc8}},
+	{"VMOVAPD", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x29,0xc8}},
+	{"VMOVAPD", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x29,0xc8}},
+	{"VPCMPEQQ", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x29,0xc8}},
+	{"VPCMPEQQ", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x29,0xc8}},
+	{"VPCMPEQQ", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x29,0xc8}},
+	{"VPMOVB2M", "k, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x29,0xc8}},
+	{"VPMOVB2M", "k, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x29,0xc8}},
+	{"VPMOVB2M", "k, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x29,0xc8}},
+	{"VPMOVW2M", "k, xmm", "ir_function", 6, {0x62,0xf2,0xfe,0x08,0x29,0xc8}},
+	{"VPMOVW2M", "k, ymm", "ir_function", 6, {0x62,0xf2,0xfe,0x28,0x29,0xc8}},
+	{"VPMOVW2M", "k, zmm", "ir_function", 6, {0x62,0xf2,0xfe,0x48,0x29,0xc8}},
+	{"VMOVNTDQA", "xmm, m128", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x2a,0x0f}},
+	{"VMOVNTDQA", "ymm, m256", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x2a,0x0f}},
+	{"VMOVNTDQA", "zmm, m512", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x2a,0x0f}},
+	{"VCVTSI2SD", "xmm, xmm, r/m32", "ir_function", 6, {0x62,0xf1,0x6f,0x08,0x2a,0xc8}},
+	{"VCVTSI2SD", "xmm, xmm, r/m64", "ir_function", 6, {0x62,0xf1,0xef,0x08,0x2a,0xc8}},
+	{"VCVTSI2SS", "xmm, xmm, r/m32", "ir_function", 6, {0x62,0xf1,0x6e,0x08,0x2a,0xc8}},
+	{"VCVTSI2SS", "xmm, xmm, r/m64", "ir_function", 6, {0x62,0xf1,0xee,0x08,0x2a,0xc8}},
+	{"VPBROADCASTMB2Q", "xmm, k", "ir_function", 6, {0x62,0xf2,0xfe,0x08,0x2a,0xc8}},
+	{"VPBROADCASTMB2Q", "ymm, k", "ir_function", 6, {0x62,0xf2,0xfe,0x28,0x2a,0xc8}},
+	{"VPBROADCASTMB2Q", "zmm, k", "ir_function", 6, {0x62,0xf2,0xfe,0x48,0x2a,0xc8}},
+	{"VMOVNTPS", "m128, xmm", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x2b,0x0f}},
+	{"VMOVNTPS", "m256, ymm", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x2b,0x0f}},
+	{"VMOVNTPS", "m512, zmm", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x2b,0x0f}},
+	{"VMOVNTPD", "m128, xmm", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x2b,0x0f}},
+	{"VMOVNTPD", "m256, ymm", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x2b,0x0f}},
+	{"VMOVNTPD", "m512, zmm", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x2b,0x0f}},
+	{"VPACKUSDW", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf2,0x6d,0x08,0x2b,0xc8}},
+	{"VPACKUSDW", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf2,0x6d,0x28,0x2b,0xc8}},
+	{"VPACKUSDW", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf2,0x6d,0x48,0x2b,0xc8}},
+	{"VSCALEFPS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x2c,0xc8}},
+	{"VSCALEFPS", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x2c,0xc8}},
+	{"VSCALEFPS", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x2c,0xc8}},
+	{"VSCALEFPD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x2c,0xc8}},
+	{"VSCALEFPD", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x2c,0xc8}},
+	{"VSCALEFPD", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x2c,0xc8}},
+	{"VCVTTSD2SI", "r32, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x2c,0xc8}},
+	{"VCVTTSD2SI", "r64, xmm/m64", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x2c,0xc8}},
+	{"VCVTTSS2SI", "r32, xmm/m32", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x2c,0xc8}},
+	{"VCVTTSS2SI", "r64, xmm/m32", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x2c,0xc8}},
+	{"VSCALEFSS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x2d,0xc8}},
+	{"VSCALEFSD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x2d,0xc8}},
+	{"VCVTSD2SI", "r32, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x2d,0xc8}},
+	{"VCVTSD2SI", "r64, xmm/m64", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x2d,0xc8}},
+	{"VCVTSS2SI", "r32, xmm/m32", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x2d,0xc8}},
+	{"VCVTSS2SI", "r64, xmm/m32", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x2d,0xc8}},
+	{"VUCOMISS", "xmm, xmm/m32", "manual", 6, {0x62,0xf1,0x7c,0x08,0x2e,0xc8}},
+	{"VUCOMISD", "xmm, xmm/m64", "manual", 6, {0x62,0xf1,0xfd,0x08,0x2e,0xc8}},
+	{"VCOMISD", "xmm, xmm/m32", "manual", 6, {0x62,0xf1,0x7c,0x08,0x2f,0xc8}},
+	{"VCOMISD", "xmm, xmm/m64", "manual", 6, {0x62,0xf1,0xfd,0x08,0x2f,0xc8}},
+	{"VPMOVZXBW", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x30,0xc8}},
+	{"VPMOVZXBW", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x30,0xc8}},
+	{"VPMOVZXBW", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x30,0xc8}},
+	{"KSHIFTRB", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0x79,0x30,0xc8,0x01}},
+	{"KSHIFTRW", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0xf9,0x30,0xc8,0x01}},
+	{"VPMOVWB", "xmm/m64, xmm", "native", 6, {0x62,0xf2,0x7e,0x08,0x30,0xc8}},
+	{"VPMOVWB", "xmm/m128, ymm", "native", 6, {0x62,0xf2,0x7e,0x28,0x30,0xc8}},
+	{"VPMOVWB", "ymm/m256, zmm", "native", 6, {0x62,0xf2,0x7e,0x48,0x30,0xc8}},
+	{"KSHIFTRD", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0x79,0x31,0xc8,0x01}},
+	{"KSHIFTRQ", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0xf9,0x31,0xc8,0x01}},
+	{"VPMOVZXBD", "xmm, xmm/m32", "native", 6, {0x62,0xf2,0x7d,0x08,0x31,0xc8}},
+	{"VPMOVZXBD", "ymm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x28,0x31,0xc8}},
+	{"VPMOVZXBD", "zmm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x48,0x31,0xc8}},
+	{"VPMOVDB", "xmm/m32, xmm", "native", 6, {0x62,0xf2,0x7e,0x08,0x31,0xc8}},
+	{"VPMOVDB", "xmm/m64, ymm", "native", 6, {0x62,0xf2,0x7e,0x28,0x31,0xc8}},
+	{"VPMOVDB", "xmm/m128, zmm", "native", 6, {0x62,0xf2,0x7e,0x48,0x31,0xc8}},
+	{"KSHIFTLB", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0x79,0x32,0xc8,0x01}},
+	{"KSHIFTLW", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0xf9,0x32,0xc8,0x01}},
+	{"VPMOVZXBQ", "xmm, xmm/m16", "native", 6, {0x62,0xf2,0x7d,0x08,0x32,0xc8}},
+	{"VPMOVZXBQ", "ymm, xmm/m32", "native", 6, {0x62,0xf2,0x7d,0x28,0x32,0xc8}},
+	{"VPMOVZXBQ", "zmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x48,0x32,0xc8}},
+	{"VPMOVQB", "xmm/m16, xmm", "native", 6, {0x62,0xf2,0x7e,0x08,0x32,0xc8}},
+	{"VPMOVQB", "xmm/m32, ymm", "native", 6, {0x62,0xf2,0x7e,0x28,0x32,0xc8}},
+	{"VPMOVQB", "xmm/m64, zmm", "native", 6, {0x62,0xf2,0x7e,0x48,0x32,0xc8}},
+	{"KSHIFTLD", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0x79,0x33,0xc8,0x01}},
+	{"KSHIFTLQ", "k, k, imm8", "ir_function", 6, {0xc4,0xe3,0xf9,0x33,0xc8,0x01}},
+	{"VPMOVZXWD", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x33,0xc8}},
+	{"VPMOVZXWD", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x33,0xc8}},
+	{"VPMOVZXWD", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x33,0xc8}},
+	{"VPMOVDW", "xmm/m64, xmm", "native", 6, {0x62,0xf2,0x7e,0x08,0x33,0xc8}},
+	{"VPMOVDW", "xmm/m128, ymm", "native", 6, {0x62,0xf2,0x7e,0x28,0x33,0xc8}},
+	{"VPMOVDW", "ymm/m256, zmm", "native", 6, {0x62,0xf2,0x7e,0x48,0x33,0xc8}},
+	{"VPMOVZXWQ", "xmm, xmm/m32", "native", 6, {0x62,0xf2,0x7d,0x08,0x34,0xc8}},
+	{"VPMOVZXWQ", "ymm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x28,0x34,0xc8}},
+	{"VPMOVZXWQ", "zmm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x48,0x34,0xc8}},
+	{"VPMOVQW", "xmm/m32, xmm", "native", 6, {0x62,0xf2,0x7e,0x08,0x34,0xc8}},
+	{"VPMOVQW", "xmm/m64, ymm", "native", 6, {0x62,0xf2,0x7e,0x28,0x34,0xc8}},
+	{"VPMOVQW", "xmm/m128, zmm", "native", 6, {0x62,0xf2,0x7e,0x48,0x34,0xc8}},
+	{"VPMOVZXDQ", "xmm, xmm/m64", "native", 6, {0x62,0xf2,0x7d,0x08,0x35,0xc8}},
+	{"VPMOVZXDQ", "ymm, xmm/m128", "native", 6, {0x62,0xf2,0x7d,0x28,0x35,0xc8}},
+	{"VPMOVZXDQ", "zmm, ymm/m256", "native", 6, {0x62,0xf2,0x7d,0x48,0x35,0xc8}},
+	{"VPMOVQD", "xmm/m64, xmm", "native", 6, {0x62,0xf2,0x7e,0x08,0x35,0xc8}},
+	{"VPMOVQD", "xmm/m128, ymm", "native", 6, {0x62,0xf2,0x7e,0x28,0x35,0xc8}},
+	{"VPMOVQD", "ymm/m256, zmm", "native", 6, {0x62,0xf2,0x7e,0x48,0x35,0xc8}},
+	{"VPERMD", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf2,0x6d,0x28,0x36,0xc8}},
+	{"VPERMD", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x36,0xc8}},
+	{"VPERMQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x36,0xc8}},
+	{"VPERMQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x36,0xc8}},
+	{"VPCMPGTQ", "k, xmm/m128, xmm", "helper", 6, {0x62,0xf2,0xed,0x08,0x37,0xc8}},
+	{"VPCMPGTQ", "k, ymm/m256, ymm", "helper", 6, {0x62,0xf2,0xed,0x28,0x37,0xc8}},
+	{"VPCMPGTQ", "k, zmm/m512, zmm", "helper", 6, {0x62,0xf2,0xed,0x48,0x37,0xc8}},
+	{"VPMINSB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x38,0xc8}},
+	{"VPMINSB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x38,0xc8}},
+	{"VPMINSB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x38,0xc8}},
+	{"VINSERTI32x4", "ymm, ymm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x38,0xc8,0x01}},
+	{"VINSERTI32x4", "zmm, zmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x38,0xc8,0x01}},
+	{"VINSERTI64x2", "ymm, ymm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x28,0x38,0xc8,0x01}},
+	{"VINSERTI64x2", "zmm, zmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x38,0xc8,0x01}},
+	{"VPMOVM2D", "xmm, k", "helper", 6, {0x62,0xf2,0x7e,0x08,0x38,0xc8}},
+	{"VPMOVM2D", "ymm, k", "helper", 6, {0x62,0xf2,0x7e,0x28,0x38,0xc8}},
+	{"VPMOVM2D", "zmm, k", "helper", 6, {0x62,0xf2,0x7e,0x48,0x38,0xc8}},
+	{"VPMOVM2Q", "xmm, k", "helper", 6, {0x62,0xf2,0xfe,0x08,0x38,0xc8}},
+	{"VPMOVM2Q", "ymm, k", "helper", 6, {0x62,0xf2,0xfe,0x28,0x38,0xc8}},
+	{"VPMOVM2Q", "zmm, k", "helper", 6, {0x62,0xf2,0xfe,0x48,0x38,0xc8}},
+	{"VPMINSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x39,0xc8}},
+	{"VPMINSD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x39,0xc8}},
+	{"VPMINSD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x39,0xc8}},
+	{"VPMINSQ", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x39,0xc8}},
+	{"VPMINSQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x39,0xc8}},
+	{"VPMINSQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x39,0xc8}},
+	{"VEXTRACTI32x4", "xmm/m128, ymm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x28,0x39,0xc8,0x01}},
+	{"VEXTRACTI32x4", "xmm/m128, zmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x48,0x39,0xc8,0x01}},
+	{"VEXTRACTI64x2", "xmm/m128, ymm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x28,0x39,0xc8,0x01}},
+	{"VEXTRACTI64x2", "xmm/m128, zmm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x39,0xc8,0x01}},
+	{"VPMOVD2M", "k, xmm", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x39,0xc8}},
+	{"VPMOVD2M", "k, ymm", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x39,0xc8}},
+	{"VPMOVD2M", "k, zmm", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x39,0xc8}},
+	{"VPMOVQ2M", "k, xmm", "ir_function", 6, {0x62,0xf2,0xfe,0x08,0x39,0xc8}},
+	{"VPMOVQ2M", "k, ymm", "ir_function", 6, {0x62,0xf2,0xfe,0x28,0x39,0xc8}},
+	{"VPMOVQ2M", "k, zmm", "ir_function", 6, {0x62,0xf2,0xfe,0x48,0x39,0xc8}},
+	{"VPMINUW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x3a,0xc8}},
+	{"VPMINUW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x3a,0xc8}},
+	{"VPMINUW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x3a,0xc8}},
+	{"VINSERTI32x8", "zmm, zmm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x3a,0xc8,0x01}},
+	{"VINSERTI64x4", "zmm, zmm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x3a,0xc8,0x01}},
+	{"VPBROADCASTMW2D", "xmm, k", "ir_function", 6, {0x62,0xf2,0x7e,0x08,0x3a,0xc8}},
+	{"VPBROADCASTMW2D", "ymm, k", "ir_function", 6, {0x62,0xf2,0x7e,0x28,0x3a,0xc8}},
+	{"VPBROADCASTMW2D", "zmm, k", "ir_function", 6, {0x62,0xf2,0x7e,0x48,0x3a,0xc8}},
+	{"VPMINUD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x3b,0xc8}},
+	{"VPMINUD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x3b,0xc8}},
+	{"VPMINUD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x3b,0xc8}},
+	{"VPMINUQ", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x3b,0xc8}},
+	{"VPMINUQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x3b,0xc8}},
+	{"VPMINUQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x3b,0xc8}},
+	{"VEXTRACTI32x8", "ymm/m256, zmm, imm8", "ir_function", 7, {0x62,0xf3,0x7d,0x48,0x3b,0xc8,0x01}},
+	{"VEXTRACTI64x4", "ymm/m256, zmm, imm8", "ir_function", 7, {0x62,0xf3,0xfd,0x48,0x3b,0xc8,0x01}},
+	{"VPMAXSB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x3c,0xc8}},
+	{"VPMAXSB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x3c,0xc8}},
+	{"VPMAXSB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x3c,0xc8}},
+	{"VPMAXSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x3d,0xc8}},
+	{"VPMAXSD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x3d,0xc8}},
+	{"VPMAXSD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x3d,0xc8}},
+	{"VPMAXSQ", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x3d,0xc8}},
+	{"VPMAXSQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x3d,0xc8}},
+	{"VPMAXSQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x3d,0xc8}},
+	{"VPCMPUB", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x3e,0xc8,0x01}},
+	{"VPCMPUB", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x3e,0xc8,0x01}},
+	{"VPCMPUB", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x3e,0xc8,0x01}},
+	{"VPCMPUW", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x3e,0xc8,0x01}},
+	{"VPCMPUW", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x3e,0xc8,0x01}},
+	{"VPCMPUW", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x3e,0xc8,0x01}},
+	{"VPMAXUW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x3e,0xc8}},
+	{"VPMAXUW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x3e,0xc8}},
+	{"VPMAXUW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x3e,0xc8}},
+	{"VPCMPB", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x3f,0xc8,0x01}},
+	{"VPCMPB", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x3f,0xc8,0x01}},
+	{"VPCMPB", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x3f,0xc8,0x01}},
+	{"VPCMPW", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x3f,0xc8,0x01}},
+	{"VPCMPW", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x3f,0xc8,0x01}},
+	{"VPCMPW", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x3f,0xc8,0x01}},
+	{"VPMAXUD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x3f,0xc8}},
+	{"VPMAXUD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x3f,0xc8}},
+	{"VPMAXUD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x3f,0xc8}},
+	{"VPMAXUQ", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x3f,0xc8}},
+	{"VPMAXUQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x3f,0xc8}},
+	{"VPMAXUQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x3f,0xc8}},
+	{"VPMULLD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x40,0xc8}},
+	{"VPMULLD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0x6d,0x28,0x40,0xc8}},
+	{"VPMULLD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0x6d,0x48,0x40,0xc8}},
+	{"VPMULLQ", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0xed,0x08,0x40,0xc8}},
+	{"VPMULLQ", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf2,0xed,0x28,0x40,0xc8}},
+	{"VPMULLQ", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf2,0xed,0x48,0x40,0xc8}},
+	{"KANDW", "k, k, k", "native", 5, {0xc4,0xe1,0x6c,0x41,0xc8}},
+	{"KANDQ", "k, k, k", "native", 5, {0xc4,0xe1,0xec,0x41,0xc8}},
+	{"KANDB", "k, k, k", "native", 5, {0xc4,0xe1,0x6d,0x41,0xc8}},
+	{"KANDD", "k, k, k", "native", 5, {0xc4,0xe1,0xed,0x41,0xc8}},
+	{"KANDNW", "k, k, k", "ir_function", 5, {0xc4,0xe1,0x6c,0x42,0xc8}},
+	{"KANDNQ", "k, k, k", "ir_function", 5, {0xc4,0xe1,0xec,0x42,0xc8}},
+	{"KANDNB", "k, k, k", "ir_function", 5, {0xc4,0xe1,0x6d,0x42,0xc8}},
+	{"KANDND", "k, k, k", "ir_function", 5, {0xc4,0xe1,0xed,0x42,0xc8}},
+	{"VGETEXPPS", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x7d,0x08,0x42,0xc8}},
+	{"VGETEXPPS", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x7d,0x28,0x42,0xc8}},
+	{"VGETEXPPS", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0x42,0xc8}},
+	{"VGETEXPPD", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xfd,0x08,0x42,0xc8}},
+	{"VGETEXPPD", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xfd,0x28,0x42,0xc8}},
+	{"VGETEXPPD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0x42,0xc8}},
+	{"VDBPSADBW", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x42,0xc8,0x01}},
+	{"VDBPSADBW", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x42,0xc8,0x01}},
+	{"VDBPSADBW", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x42,0xc8,0x01}},
+	{"VGETEXPSS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x43,0xc8}},
+	{"VGETEXPSD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x43,0xc8}},
+	{"VSHUFI32x4", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x43,0xc8,0x01}},
+	{"VSHUFI32x4", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x43,0xc8,0x01}},
+	{"VSHUFI64x2", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x28,0x43,0xc8,0x01}},
+	{"VSHUFI64x2", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0xed,0x48,0x43,0xc8,0x01}},
+	{"KNOTW", "k, k", "native", 5, {0xc4,0xe1,0x78,0x44,0xc8}},
+	{"KNOTQ", "k, k", "native", 5, {0xc4,0xe1,0xf8,0x44,0xc8}},
+	{"KNOTB", "k, k", "native", 5, {0xc4,0xe1,0x79,0x44,0xc8}},
+	{"KNOTD", "k, k", "native", 5, {0xc4,0xe1,0xf9,0x44,0xc8}},
+	{"VPLZCNTD", "xmm, xmm/m128", "isel", 6, {0x62,0xf2,0x7d,0x08,0x44,0xc8}},
+	{"VPLZCNTD", "ymm, ymm/m256", "isel", 6, {0x62,0xf2,0x7d,0x28,0x44,0xc8}},
+	{"VPLZCNTD", "zmm, zmm/m512", "isel", 6, {0x62,0xf2,0x7d,0x48,0x44,0xc8}},
+	{"VPLZCNTQ", "xmm, xmm/m128", "native", 6, {0x62,0xf2,0xfd,0x08,0x44,0xc8}},
+	{"VPLZCNTQ", "ymm, ymm/m256", "native", 6, {0x62,0xf2,0xfd,0x28,0x44,0xc8}},
+	{"VPLZCNTQ", "zmm, zmm/m512", "native", 6, {0x62,0xf2,0xfd,0x48,0x44,0xc8}},
+	{"VPCLMULQDQ", "xmm, xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x08,0x44,0xc8,0x01}},
+	{"VPCLMULQDQ", "ymm, ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x28,0x44,0xc8,0x01}},
+	{"VPCLMULQDQ", "zmm, zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf3,0x6d,0x48,0x44,0xc8,0x01}},
+	{"KORW", "k, k, k", "native", 5, {0xc4,0xe1,0x6c,0x45,0xc8}},
+	{"KORQ", "k, k, k", "native", 5, {0xc4,0xe1,0xec,0x45,0xc8}},
+	{"KORB", "k, k, k", "native", 5, {0xc4,0xe1,0x6d,0x45,0xc8}},
+	{"KORD", "k, k, k", "native", 5, {0xc4,0xe1,0xed,0x45,0xc8}},
+	{"VPSRLVD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x45,0xc8}},
+	{"VPSRLVD", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x45,0xc8}},
+	{"VPSRLVD", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x45,0xc8}},
+	{"VPSRLVQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x45,0xc8}},
+	{"VPSRLVQ", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x45,0xc8}},
+	{"VPSRLVQ", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x45,0xc8}},
+	{"KXNORW", "k, k, k", "ir_function", 5, {0xc4,0xe1,0x6c,0x46,0xc8}},
+	{"KXNORQ", "k, k, k", "ir_function", 5, {0xc4,0xe1,0xec,0x46,0xc8}},
+	{"KXNORB", "k, k, k", "ir_function", 5, {0xc4,0xe1,0x6d,0x46,0xc8}},
+	{"KXNORD", "k, k, k", "ir_function", 5, {0xc4,0xe1,0xed,0x46,0xc8}},
+	{"VPSRAVD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x46,0xc8}},
+	{"VPSRAVD", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x46,0xc8}},
+	{"VPSRAVD", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x46,0xc8}},
+	{"VPSRAVQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x46,0xc8}},
+	{"VPSRAVQ", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x46,0xc8}},
+	{"VPSRAVQ", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x46,0xc8}},
+	{"KXORW", "k, k, k", "native", 5, {0xc4,0xe1,0x6c,0x47,0xc8}},
+	{"KXORQ", "k, k, k", "native", 5, {0xc4,0xe1,0xec,0x47,0xc8}},
+	{"KXORB", "k, k, k", "native", 5, {0xc4,0xe1,0x6d,0x47,0xc8}},
+	{"KXORD", "k, k, k", "native", 5, {0xc4,0xe1,0xed,0x47,0xc8}},
+	{"VPSRAVD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x47,0xc8}},
+	{"VPSRAVD", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x47,0xc8}},
+	{"VPSRAVD", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x47,0xc8}},
+	{"VPSRAVQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x47,0xc8}},
+	{"VPSRAVQ", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x47,0xc8}},
+	{"VPSRAVQ", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x47,0xc8}},
+	{"KADDW", "k, k, k", "native", 5, {0xc4,0xe1,0x6c,0x4a,0xc8}},
+	{"KADDQ", "k, k, k", "native", 5, {0xc4,0xe1,0xec,0x4a,0xc8}},
+	{"KADDB", "k, k, k", "native", 5, {0xc4,0xe1,0x6d,0x4a,0xc8}},
+	{"KADDD", "k, k, k", "native", 5, {0xc4,0xe1,0xed,0x4a,0xc8}},
+	{"KUNPCKWD", "k, k, k", "native", 5, {0xc4,0xe1,0x6c,0x4b,0xc8}},
+	{"KUNPCKDQ", "k, k, k", "native", 5, {0xc4,0xe1,0xec,0x4b,0xc8}},
+	{"KUNPCKBW", "k, k, k", "native", 5, {0xc4,0xe1,0x6d,0x4b,0xc8}},
+	{"VRCP14PS", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x7d,0x08,0x4c,0xc8}},
+	{"VRCP14PS", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x7d,0x28,0x4c,0xc8}},
+	{"VRCP14PS", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0x4c,0xc8}},
+	{"VRCP14PD", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xfd,0x08,0x4c,0xc8}},
+	{"VRCP14PD", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xfd,0x28,0x4c,0xc8}},
+	{"VRCP14PD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0x4c,0xc8}},
+	{"VRCP14SS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x4d,0xc8}},
+	{"VRCP14SD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x4d,0xc8}},
+	{"VRSQRT14PS", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x7d,0x08,0x4e,0xc8}},
+	{"VRSQRT14PS", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x7d,0x28,0x4e,0xc8}},
+	{"VRSQRT14PS", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0x4e,0xc8}},
+	{"VRSQRT14PD", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xfd,0x08,0x4e,0xc8}},
+	{"VRSQRT14PD", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xfd,0x28,0x4e,0xc8}},
+	{"VRSQRT14PD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0x4e,0xc8}},
+	{"VRSQRT14SS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x4f,0xc8}},
+	{"VRSQRT14SD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x4f,0xc8}},
+	{"VRANGEPS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x50,0xc8,0x01}},
+	{"VRANGEPS", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x50,0xc8,0x01}},
+	{"VRANGEPS", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x50,0xc8,0x01}},
+	{"VRANGEPD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x50,0xc8,0x01}},
+	{"VRANGEPD", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x50,0xc8,0x01}},
+	{"VRANGEPD", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x50,0xc8,0x01}},
+	{"VPDPBUSD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x50,0xc8}},
+	{"VPDPBUSD", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x50,0xc8}},
+	{"VPDPBUSD", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x50,0xc8}},
+	{"VSQRTPS", "xmm, xmm/m128", "native", 6, {0x62,0xf1,0x7c,0x08,0x51,0xc8}},
+	{"VSQRTPS", "ymm, ymm/m256", "native", 6, {0x62,0xf1,0x7c,0x28,0x51,0xc8}},
+	{"VSQRTPS", "zmm, zmm/m512", "native", 6, {0x62,0xf1,0x7c,0x48,0x51,0xc8}},
+	{"VSQRTPD", "xmm, xmm/m128", "native", 6, {0x62,0xf1,0xfd,0x08,0x51,0xc8}},
+	{"VSQRTPD", "ymm, ymm/m256", "native", 6, {0x62,0xf1,0xfd,0x28,0x51,0xc8}},
+	{"VSQRTPD", "zmm, zmm/m512", "native", 6, {0x62,0xf1,0xfd,0x48,0x51,0xc8}},
+	{"VRANGESS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x51,0xc8,0x01}},
+	{"VRANGESD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x51,0xc8,0x01}},
+	{"VPDPBUSDS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x51,0xc8}},
+	{"VPDPBUSDS", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x51,0xc8}},
+	{"VPDPBUSDS", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x51,0xc8}},
+	{"VSQRTSD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xef,0x08,0x51,0xc8}},
+	{"VSQRTSS", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x6e,0x08,0x51,0xc8}},
+	{"VPDPWSSD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x52,0xc8}},
+	{"VPDPWSSD", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x52,0xc8}},
+	{"VPDPWSSD", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x52,0xc8}},
+	{"VPDPWSSDS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x53,0xc8}},
+	{"VPDPWSSDS", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x53,0xc8}},
+	{"VPDPWSSDS", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x53,0xc8}},
+	{"VANDPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x54,0xc8}},
+	{"VANDPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x54,0xc8}},
+	{"VANDPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x54,0xc8}},
+	{"VANDPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x54,0xc8}},
+	{"VANDPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x54,0xc8}},
+	{"VANDPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x54,0xc8}},
+	{"VFIXUPIMMPS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x54,0xc8,0x01}},
+	{"VFIXUPIMMPS", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x6d,0x28,0x54,0xc8,0x01}},
+	{"VFIXUPIMMPS", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x6d,0x48,0x54,0xc8,0x01}},
+	{"VFIXUPIMMPD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x54,0xc8,0x01}},
+	{"VFIXUPIMMPD", "ymm, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xed,0x28,0x54,0xc8,0x01}},
+	{"VFIXUPIMMPD", "zmm, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xed,0x48,0x54,0xc8,0x01}},
+	{"VPOPCNTB", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x7d,0x08,0x54,0xc8}},
+	{"VPOPCNTB", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x7d,0x28,0x54,0xc8}},
+	{"VPOPCNTB", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0x54,0xc8}},
+	{"VPOPCNTW", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xfd,0x08,0x54,0xc8}},
+	{"VPOPCNTW", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x54,0xc8}},
+	{"VPOPCNTW", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x54,0xc8}},
+	{"VANDNPS", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x6c,0x08,0x55,0xc8}},
+	{"VANDNPS", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x6c,0x28,0x55,0xc8}},
+	{"VANDNPS", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x6c,0x48,0x55,0xc8}},
+	{"VANDNPD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xed,0x08,0x55,0xc8}},
+	{"VANDNPD", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xed,0x28,0x55,0xc8}},
+	{"VANDNPD", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xed,0x48,0x55,0xc8}},
+	{"VPOPCNTD", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x55,0xc8}},
+	{"VPOPCNTD", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x55,0xc8}},
+	{"VPOPCNTD", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x55,0xc8}},
+	{"VPOPCNTQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0xfd,0x08,0x55,0xc8}},
+	{"VPOPCNTQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x55,0xc8}},
+	{"VPOPCNTQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x55,0xc8}},
+	{"VFIXUPIMMSS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x55,0xc8,0x01}},
+	{"VFIXUPIMMSD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x55,0xc8,0x01}},
+	{"VORPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x56,0xc8}},
+	{"VORPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x56,0xc8}},
+	{"VORPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x56,0xc8}},
+	{"VORPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x56,0xc8}},
+	{"VORPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x56,0xc8}},
+	{"VORPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x56,0xc8}},
+	{"VREDUCEPS", "xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x7d,0x08,0x56,0xc8,0x01}},
+	{"VREDUCEPS", "ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x7d,0x28,0x56,0xc8,0x01}},
+	{"VREDUCEPS", "zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x7d,0x48,0x56,0xc8,0x01}},
+	{"VREDUCEPD", "xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xfd,0x08,0x56,0xc8,0x01}},
+	{"VREDUCEPD", "ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xfd,0x28,0x56,0xc8,0x01}},
+	{"VREDUCEPD", "zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xfd,0x48,0x56,0xc8,0x01}},
+	{"VXORPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x57,0xc8}},
+	{"VXORPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x57,0xc8}},
+	{"VXORPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x57,0xc8}},
+	{"VXORPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x57,0xc8}},
+	{"VXORPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x57,0xc8}},
+	{"VXORPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x57,0xc8}},
+	{"VREDUCESS", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x6d,0x08,0x57,0xc8,0x01}},
+	{"VREDUCESD", "xmm, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xed,0x08,0x57,0xc8,0x01}},
+	{"VADDPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x58,0xc8}},
+	{"VADDPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x58,0xc8}},
+	{"VADDPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x58,0xc8}},
+	{"VADDPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x58,0xc8}},
+	{"VADDPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x58,0xc8}},
+	{"VADDPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x58,0xc8}},
+	{"VPBROADCASTD", "xmm, xmm/m32", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x58,0xc8}},
+	{"VPBROADCASTD", "ymm, xmm/m32", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x58,0xc8}},
+	{"VPBROADCASTD", "zmm, xmm/m32", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x58,0xc8}},
+	{"VADDSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xef,0x08,0x58,0xc8}},
+	{"VADDSS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6e,0x08,0x58,0xc8}},
+	{"VMULPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x59,0xc8}},
+	{"VMULPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x59,0xc8}},
+	{"VMULPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x59,0xc8}},
+	{"VMULPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x59,0xc8}},
+	{"VMULPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x59,0xc8}},
+	{"VMULPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x59,0xc8}},
+	{"VBROADCASTI32x2", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x59,0xc8}},
+	{"VBROADCASTI32x2", "ymm, xmm/m64", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x59,0xc8}},
+	{"VBROADCASTI32x2", "zmm, xmm/m64", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x59,0xc8}},
+	{"VPBROADCASTQ", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf2,0xfd,0x08,0x59,0xc8}},
+	{"VPBROADCASTQ", "ymm, xmm/m64", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x59,0xc8}},
+	{"VPBROADCASTQ", "zmm, xmm/m64", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x59,0xc8}},
+	{"VMULSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xef,0x08,0x59,0xc8}},
+	{"VMULSS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6e,0x08,0x59,0xc8}},
+	{"VCVTPS2PD", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x5a,0xc8}},
+	{"VCVTPS2PD", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x5a,0xc8}},
+	{"VCVTPS2PD", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x5a,0xc8}},
+	{"VCVTPD2PS", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x5a,0xc8}},
+	{"VCVTPD2PS", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x5a,0xc8}},
+	{"VCVTPD2PS", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x5a,0xc8}},
+	{"VBROADCASTI32x4", "ymm, m128", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x5a,0x0f}},
+	{"VBROADCASTI32x4", "zmm, m128", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x5a,0x0f}},
+	{"VBROADCASTI64x2", "ymm, m128", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x5a,0x0f}},
+	{"VBROADCASTI64x2", "zmm, m128", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x5a,0x0f}},
+	{"VCVTSD2SS", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xef,0x08,0x5a,0xc8}},
+	{"VCVTSS2SD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x6e,0x08,0x5a,0xc8}},
+	{"VCVTDQ2PS", "xmm, xmm/m128", "native", 6, {0x62,0xf1,0x7c,0x08,0x5b,0xc8}},
+	{"VCVTDQ2PS", "ymm, ymm/m256", "native", 6, {0x62,0xf1,0x7c,0x28,0x5b,0xc8}},
+	{"VCVTDQ2PS", "zmm, zmm/m512", "native", 6, {0x62,0xf1,0x7c,0x48,0x5b,0xc8}},
+	{"VCVTQQ2PS", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfc,0x08,0x5b,0xc8}},
+	{"VCVTQQ2PS", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfc,0x28,0x5b,0xc8}},
+	{"VCVTQQ2PS", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfc,0x48,0x5b,0xc8}},
+	{"VCVTPS2DQ", "xmm, xmm/m128", "native", 6, {0x62,0xf1,0x7d,0x08,0x5b,0xc8}},
+	{"VCVTPS2DQ", "ymm, ymm/m256", "native", 6, {0x62,0xf1,0x7d,0x28,0x5b,0xc8}},
+	{"VCVTPS2DQ", "zmm, zmm/m512", "native", 6, {0x62,0xf1,0x7d,0x48,0x5b,0xc8}},
+	{"VBROADCASTI32x8", "zmm, m256", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x5b,0x0f}},
+	{"VBROADCASTI64x4", "zmm, m256", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x5b,0x0f}},
+	{"VCVTTPS2DQ", "xmm, xmm/m128", "native", 6, {0x62,0xf1,0x7e,0x08,0x5b,0xc8}},
+	{"VCVTTPS2DQ", "ymm, ymm/m256", "native", 6, {0x62,0xf1,0x7e,0x28,0x5b,0xc8}},
+	{"VCVTTPS2DQ", "zmm, zmm/m512", "native", 6, {0x62,0xf1,0x7e,0x48,0x5b,0xc8}},
+	{"VSUBPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x5c,0xc8}},
+	{"VSUBPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x5c,0xc8}},
+	{"VSUBPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x5c,0xc8}},
+	{"VSUBPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x5c,0xc8}},
+	{"VSUBPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x5c,0xc8}},
+	{"VSUBPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x5c,0xc8}},
+	{"VSUBSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xef,0x08,0x5c,0xc8}},
+	{"VSUBSS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6e,0x08,0x5c,0xc8}},
+	{"VMINPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x5d,0xc8}},
+	{"VMINPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x5d,0xc8}},
+	{"VMINPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x5d,0xc8}},
+	{"VMINPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x5d,0xc8}},
+	{"VMINPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x5d,0xc8}},
+	{"VMINPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x5d,0xc8}},
+	{"VMINSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xef,0x08,0x5d,0xc8}},
+	{"VMINSS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6e,0x08,0x5d,0xc8}},
+	{"VDIVPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x5e,0xc8}},
+	{"VDIVPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x5e,0xc8}},
+	{"VDIVPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x5e,0xc8}},
+	{"VDIVPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x5e,0xc8}},
+	{"VDIVPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x5e,0xc8}},
+	{"VDIVPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x5e,0xc8}},
+	{"VDIVSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xef,0x08,0x5e,0xc8}},
+	{"VDIVSS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6e,0x08,0x5e,0xc8}},
+	{"VMAXPS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6c,0x08,0x5f,0xc8}},
+	{"VMAXPS", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6c,0x28,0x5f,0xc8}},
+	{"VMAXPS", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6c,0x48,0x5f,0xc8}},
+	{"VMAXPD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0x5f,0xc8}},
+	{"VMAXPD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0x5f,0xc8}},
+	{"VMAXPD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0x5f,0xc8}},
+	{"VMAXSD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xef,0x08,0x5f,0xc8}},
+	{"VMAXSS", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6e,0x08,0x5f,0xc8}},
+	{"VPUNPCKLBW", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x60,0xc8}},
+	{"VPUNPCKLBW", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x60,0xc8}},
+	{"VPUNPCKLBW", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x60,0xc8}},
+	{"VPUNPCKLWD", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x61,0xc8}},
+	{"VPUNPCKLWD", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x61,0xc8}},
+	{"VPUNPCKLWD", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x61,0xc8}},
+	{"VPUNPCKLDQ", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x62,0xc8}},
+	{"VPUNPCKLDQ", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x62,0xc8}},
+	{"VPUNPCKLDQ", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x62,0xc8}},
+	{"VPEXPANDB", "xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x7d,0x08,0x62,0xc8}},
+	{"VPEXPANDB", "ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x7d,0x28,0x62,0xc8}},
+	{"VPEXPANDB", "zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x7d,0x48,0x62,0xc8}},
+	{"VPEXPANDW", "xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xfd,0x08,0x62,0xc8}},
+	{"VPEXPANDW", "ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xfd,0x28,0x62,0xc8}},
+	{"VPEXPANDW", "zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xfd,0x48,0x62,0xc8}},
+	{"VPACKSSWB", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x63,0xc8}},
+	{"VPACKSSWB", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x63,0xc8}},
+	{"VPACKSSWB", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x63,0xc8}},
+	{"VPCOMPRESSB", "xmm/m128, xmm", "helper", 6, {0x62,0xf2,0x7d,0x08,0x63,0xc8}},
+	{"VPCOMPRESSB", "ymm/m256, ymm", "helper", 6, {0x62,0xf2,0x7d,0x28,0x63,0xc8}},
+	{"VPCOMPRESSB", "zmm/m512, zmm", "helper", 6, {0x62,0xf2,0x7d,0x48,0x63,0xc8}},
+	{"VPCOMPRESSW", "xmm/m128, xmm", "helper", 6, {0x62,0xf2,0xfd,0x08,0x63,0xc8}},
+	{"VPCOMPRESSW", "ymm/m256, ymm", "helper", 6, {0x62,0xf2,0xfd,0x28,0x63,0xc8}},
+	{"VPCOMPRESSW", "zmm/m512, zmm", "helper", 6, {0x62,0xf2,0xfd,0x48,0x63,0xc8}},
+	{"VPCMPGTB", "k, xmm/m128, xmm", "helper", 6, {0x62,0xf1,0x6d,0x08,0x64,0xc8}},
+	{"VPCMPGTB", "k, ymm/m256, ymm", "helper", 6, {0x62,0xf1,0x6d,0x28,0x64,0xc8}},
+	{"VPCMPGTB", "k, zmm/m512, zmm", "helper", 6, {0x62,0xf1,0x6d,0x48,0x64,0xc8}},
+	{"VPBLENDMD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x64,0xc8}},
+	{"VPBLENDMD", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x64,0xc8}},
+	{"VPBLENDMD", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x64,0xc8}},
+	{"VPBLENDMQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x64,0xc8}},
+	{"VPBLENDMQ", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x64,0xc8}},
+	{"VPBLENDMQ", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x64,0xc8}},
+	{"VPCMPGTW", "k, xmm/m128, xmm", "helper", 6, {0x62,0xf1,0x6d,0x08,0x65,0xc8}},
+	{"VPCMPGTW", "k, ymm/m256, ymm", "helper", 6, {0x62,0xf1,0x6d,0x28,0x65,0xc8}},
+	{"VPCMPGTW", "k, zmm/m512, zmm", "helper", 6, {0x62,0xf1,0x6d,0x48,0x65,0xc8}},
+	{"VBLENDMPD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x65,0xc8}},
+	{"VBLENDMPD", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x65,0xc8}},
+	{"VBLENDMPD", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x65,0xc8}},
+	{"VBLENDMPS", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x65,0xc8}},
+	{"VBLENDMPS", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x65,0xc8}},
+	{"VBLENDMPS", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x65,0xc8}},
+	{"VPCMPGTD", "k, xmm/m128, xmm", "helper", 6, {0x62,0xf1,0x6d,0x08,0x66,0xc8}},
+	{"VPCMPGTD", "k, ymm/m256, ymm", "helper", 6, {0x62,0xf1,0x6d,0x28,0x66,0xc8}},
+	{"VPCMPGTD", "k, zmm/m512, zmm", "helper", 6, {0x62,0xf1,0x6d,0x48,0x66,0xc8}},
+	{"VPBLENDMB", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x66,0xc8}},
+	{"VPBLENDMB", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x66,0xc8}},
+	{"VPBLENDMB", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x66,0xc8}},
+	{"VPBLENDMW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x66,0xc8}},
+	{"VPBLENDMW", "ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x66,0xc8}},
+	{"VPBLENDMW", "zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x66,0xc8}},
+	{"VFPCLASSPS", "k, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x7d,0x08,0x66,0xc8,0x01}},
+	{"VFPCLASSPS", "k, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0x7d,0x28,0x66,0xc8,0x01}},
+	{"VFPCLASSPS", "k, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0x7d,0x48,0x66,0xc8,0x01}},
+	{"VFPCLASSPD", "k, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xfd,0x08,0x66,0xc8,0x01}},
+	{"VFPCLASSPD", "k, ymm/m256, imm8", "helper", 7, {0x62,0xf3,0xfd,0x28,0x66,0xc8,0x01}},
+	{"VFPCLASSPD", "k, zmm/m512, imm8", "helper", 7, {0x62,0xf3,0xfd,0x48,0x66,0xc8,0x01}},
+	{"VPACKUSWB", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x67,0xc8}},
+	{"VPACKUSWB", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x67,0xc8}},
+	{"VPACKUSWB", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x67,0xc8}},
+	{"VFPCLASSSS", "k, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0x7d,0x08,0x67,0xc8,0x01}},
+	{"VFPCLASSSD", "k, xmm/m128, imm8", "helper", 7, {0x62,0xf3,0xfd,0x08,0x67,0xc8,0x01}},
+	{"VPUNPCKHBW", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x68,0xc8}},
+	{"VPUNPCKHBW", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x68,0xc8}},
+	{"VPUNPCKHBW", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x68,0xc8}},
+	{"VP2INTERSECTD", "k, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0x68,0xc8}},
+	{"VP2INTERSECTD", "k, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0x68,0xc8}},
+	{"VP2INTERSECTD", "k, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0x68,0xc8}},
+	{"VP2INTERSECTQ", "k, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0x68,0xc8}},
+	{"VP2INTERSECTQ", "k, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0x68,0xc8}},
+	{"VP2INTERSECTQ", "k, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0x68,0xc8}},
+	{"VPUNPCKHWD", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x69,0xc8}},
+	{"VPUNPCKHWD", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x69,0xc8}},
+	{"VPUNPCKHWD", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x69,0xc8}},
+	{"VPUNPCKHDQ", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x6a,0xc8}},
+	{"VPUNPCKHDQ", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x6a,0xc8}},
+	{"VPUNPCKHDQ", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x6a,0xc8}},
+	{"VPACKSSDW", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0x6d,0x08,0x6b,0xc8}},
+	{"VPACKSSDW", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0x6d,0x28,0x6b,0xc8}},
+	{"VPACKSSDW", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0x6d,0x48,0x6b,0xc8}},
+	{"VPUNPCKLQDQ", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0xed,0x08,0x6c,0xc8}},
+	{"VPUNPCKLQDQ", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0xed,0x28,0x6c,0xc8}},
+	{"VPUNPCKLQDQ", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0xed,0x48,0x6c,0xc8}},
+	{"VPUNPCKHQDQ", "xmm, xmm/m128, xmm", "native", 6, {0x62,0xf1,0xed,0x08,0x6d,0xc8}},
+	{"VPUNPCKHQDQ", "ymm, ymm/m256, ymm", "native", 6, {0x62,0xf1,0xed,0x28,0x6d,0xc8}},
+	{"VPUNPCKHQDQ", "zmm, zmm/m512, zmm", "native", 6, {0x62,0xf1,0xed,0x48,0x6d,0xc8}},
+	{"VMOVD", "xmm, r/m32", "native", 6, {0x62,0xf1,0x7d,0x08,0x6e,0xc8}},
+	{"VMOVQ", "xmm, r/m64", "native", 6, {0x62,0xf1,0xfd,0x08,0x6e,0xc8}},
+	{"VMOVDQA64", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x6f,0xc8}},
+	{"VMOVDQA64", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x6f,0xc8}},
+	{"VMOVDQA64", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x6f,0xc8}},
+	{"VMOVDQA32", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0x6f,0xc8}},
+	{"VMOVDQA32", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0x6f,0xc8}},
+	{"VMOVDQA32", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0x6f,0xc8}},
+	{"VMOVDQU8", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x6f,0xc8}},
+	{"VMOVDQU8", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7f,0x28,0x6f,0xc8}},
+	{"VMOVDQU8", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7f,0x48,0x6f,0xc8}},
+	{"VMOVDQU16", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x6f,0xc8}},
+	{"VMOVDQU16", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xff,0x28,0x6f,0xc8}},
+	{"VMOVDQU16", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xff,0x48,0x6f,0xc8}},
+	{"VMOVDQU32", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x6f,0xc8}},
+	{"VMOVDQU32", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7e,0x28,0x6f,0xc8}},
+	{"VMOVDQU32", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7e,0x48,0x6f,0xc8}},
+	{"VMOVDQU64", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x6f,0xc8}},
+	{"VMOVDQU64", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfe,0x28,0x6f,0xc8}},
+	{"VMOVDQU64", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfe,0x48,0x6f,0xc8}},
+	{"VPSHUFD", "xmm, xmm, imm8", "ir_function", 7, {0x62,0xf1,0x7d,0x08,0x70,0xc8,0x01}},
+	{"VPSHUFD", "ymm, ymm, imm8", "ir_function", 7, {0x62,0xf1,0x7d,0x28,0x70,0xc8,0x01}},
+	{"VPSHUFD", "zmm, zmm, imm8", "ir_function", 7, {0x62,0xf1,0x7d,0x48,0x70,0xc8,0x01}},
+	{"VPSHLDW", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0xed,0x08,0x70,0xc8,0x01}},
+	{"VPSHLDW", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0xed,0x28,0x70,0xc8,0x01}},
+	{"VPSHLDW", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0xed,0x48,0x70,0xc8,0x01}},
+	{"VPSHUFLW", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf1,0x7f,0x08,0x70,0xc8,0x01}},
+	{"VPSHUFLW", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf1,0x7f,0x28,0x70,0xc8,0x01}},
+	{"VPSHUFLW", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf1,0x7f,0x48,0x70,0xc8,0x01}},
+	{"VPSHUFHW", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf1,0x7e,0x08,0x70,0xc8,0x01}},
+	{"VPSHUFHW", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf1,0x7e,0x28,0x70,0xc8,0x01}},
+	{"VPSHUFHW", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf1,0x7e,0x48,0x70,0xc8,0x01}},
+	{"VPSRLW", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0x6d,0x08,0x71,0xd0,0x01}},
+	{"VPSRLW", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0x6d,0x28,0x71,0xd0,0x01}},
+	{"VPSRLW", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0x6d,0x48,0x71,0xd0,0x01}},
+	{"VPSRAW", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0x6d,0x08,0x71,0xe0,0x01}},
+	{"VPSRAW", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0x6d,0x28,0x71,0xe0,0x01}},
+	{"VPSRAW", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0x6d,0x48,0x71,0xe0,0x01}},
+	{"VPSLLW", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0x6d,0x08,0x71,0xf0,0x01}},
+	{"VPSLLW", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0x6d,0x28,0x71,0xf0,0x01}},
+	{"VPSLLW", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0x6d,0x48,0x71,0xf0,0x01}},
+	{"VPSHLDVD", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0x6d,0x08,0x71,0xc8,0x01}},
+	{"VPSHLDVD", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0x6d,0x28,0x71,0xc8,0x01}},
+	{"VPSHLDVD", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0x6d,0x48,0x71,0xc8,0x01}},
+	{"VPSHLDVQ", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0xed,0x08,0x71,0xc8,0x01}},
+	{"VPSHLDVQ", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0xed,0x28,0x71,0xc8,0x01}},
+	{"VPSHLDVQ", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0xed,0x48,0x71,0xc8,0x01}},
+	{"VPRORD", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x08,0x72,0xc0,0x01}},
+	{"VPRORD", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x28,0x72,0xc0,0x01}},
+	{"VPRORD", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x48,0x72,0xc0,0x01}},
+	{"VPROLD", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x08,0x72,0xc8,0x01}},
+	{"VPROLD", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x28,0x72,0xc8,0x01}},
+	{"VPROLD", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x48,0x72,0xc8,0x01}},
+	{"VPSRLD", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0x6d,0x08,0x72,0xd0,0x01}},
+	{"VPSRLD", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0x6d,0x28,0x72,0xd0,0x01}},
+	{"VPSRLD", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0x6d,0x48,0x72,0xd0,0x01}},
+	{"VPSRAD", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0x6d,0x08,0x72,0xe0,0x01}},
+	{"VPSRAD", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0x6d,0x28,0x72,0xe0,0x01}},
+	{"VPSRAD", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0x6d,0x48,0x72,0xe0,0x01}},
+	{"VPSLLD", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0x6d,0x08,0x72,0xf0,0x01}},
+	{"VPSLLD", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0x6d,0x28,0x72,0xf0,0x01}},
+	{"VPSLLD", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0x6d,0x48,0x72,0xf0,0x01}},
+	{"VPRORQ", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x08,0x72,0xc0,0x01}},
+	{"VPRORQ", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x28,0x72,0xc0,0x01}},
+	{"VPRORQ", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x48,0x72,0xc0,0x01}},
+	{"VPROLQ", "xmm, xmm/m128, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x08,0x72,0xc8,0x01}},
+	{"VPROLQ", "ymm, ymm/m256, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x28,0x72,0xc8,0x01}},
+	{"VPROLQ", "zmm, zmm/m512, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x48,0x72,0xc8,0x01}},
+	{"VPSRAQ", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0xed,0x08,0x72,0xe0,0x01}},
+	{"VPSRAQ", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0xed,0x28,0x72,0xe0,0x01}},
+	{"VPSRAQ", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0xed,0x48,0x72,0xe0,0x01}},
+	{"VPSHRDVW", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf2,0xed,0x08,0x72,0xc8,0x01}},
+	{"VPSHRDVW", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf2,0xed,0x28,0x72,0xc8,0x01}},
+	{"VPSHRDVW", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf2,0xed,0x48,0x72,0xc8,0x01}},
+	{"VPSHRDW", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0xed,0x08,0x72,0xc8,0x01}},
+	{"VPSHRDW", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0xed,0x28,0x72,0xc8,0x01}},
+	{"VPSHRDW", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0xed,0x48,0x72,0xc8,0x01}},
+	{"VCVTNE2PS2BF16", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf2,0x6f,0x08,0x72,0xc8}},
+	{"VCVTNE2PS2BF16", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf2,0x6f,0x28,0x72,0xc8}},
+	{"VCVTNE2PS2BF16", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf2,0x6f,0x48,0x72,0xc8}},
+	{"VPSRLQ", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0xed,0x08,0x73,0xd0,0x01}},
+	{"VPSRLQ", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0xed,0x28,0x73,0xd0,0x01}},
+	{"VPSRLQ", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0xed,0x48,0x73,0xd0,0x01}},
+	{"VPSRLDQ", "xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf1,0x6d,0x08,0x73,0xd8,0x01}},
+	{"VPSRLDQ", "ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf1,0x6d,0x28,0x73,0xd8,0x01}},
+	{"VPSRLDQ", "zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf1,0x6d,0x48,0x73,0xd8,0x01}},
+	{"VPSLLQ", "xmm, xmm/m128, imm8", "manual", 7, {0x62,0xf1,0xed,0x08,0x73,0xf0,0x01}},
+	{"VPSLLQ", "ymm, ymm/m256, imm8", "manual", 7, {0x62,0xf1,0xed,0x28,0x73,0xf0,0x01}},
+	{"VPSLLQ", "zmm, zmm/m512, imm8", "manual", 7, {0x62,0xf1,0xed,0x48,0x73,0xf0,0x01}},
+	{"VPSLLDQ", "xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf1,0xed,0x08,0x73,0xf8,0x01}},
+	{"VPSLLDQ", "ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf1,0xed,0x28,0x73,0xf8,0x01}},
+	{"VPSLLDQ", "zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf1,0xed,0x48,0x73,0xf8,0x01}},
+	{"VPSHRDVD", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf2,0x6d,0x08,0x73,0xc8,0x01}},
+	{"VPSHRDVD", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf2,0x6d,0x28,0x73,0xc8,0x01}},
+	{"VPSHRDVD", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf2,0x6d,0x48,0x73,0xc8,0x01}},
+	{"VPSHRDD", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0x6d,0x08,0x73,0xc8,0x01}},
+	{"VPSHRDD", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0x6d,0x28,0x73,0xc8,0x01}},
+	{"VPSHRDD", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0x6d,0x48,0x73,0xc8,0x01}},
+	{"VPSHRDVQ", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf2,0xed,0x08,0x73,0xc8,0x01}},
+	{"VPSHRDVQ", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf2,0xed,0x28,0x73,0xc8,0x01}},
+	{"VPSHRDVQ", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf2,0xed,0x48,0x73,0xc8,0x01}},
+	{"VPSHRDQ", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0xed,0x08,0x73,0xc8,0x01}},
+	{"VPSHRDQ", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0xed,0x28,0x73,0xc8,0x01}},
+	{"VPSHRDQ", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0xed,0x48,0x73,0xc8,0x01}},
+	{"VPCMPEQB", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf1,0x6d,0x08,0x74,0xc8}},
+	{"VPCMPEQB", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf1,0x6d,0x28,0x74,0xc8}},
+	{"VPCMPEQB", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf1,0x6d,0x48,0x74,0xc8}},
+	{"VPCMPEQW", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf1,0x6d,0x08,0x75,0xc8}},
+	{"VPCMPEQW", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf1,0x6d,0x28,0x75,0xc8}},
+	{"VPCMPEQW", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf1,0x6d,0x48,0x75,0xc8}},
+	{"VPERMI2B", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x75,0xc8}},
+	{"VPERMI2B", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x75,0xc8}},
+	{"VPERMI2B", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x75,0xc8}},
+	{"VPERMI2W", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x75,0xc8}},
+	{"VPERMI2W", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x75,0xc8}},
+	{"VPERMI2W", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x75,0xc8}},
+	{"VPCMPEQD", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf1,0x6d,0x08,0x76,0xc8}},
+	{"VPCMPEQD", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf1,0x6d,0x28,0x76,0xc8}},
+	{"VPCMPEQD", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf1,0x6d,0x48,0x76,0xc8}},
+	{"VPERMI2D", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x76,0xc8}},
+	{"VPERMI2D", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x76,0xc8}},
+	{"VPERMI2D", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x76,0xc8}},
+	{"VPERMI2Q", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x76,0xc8}},
+	{"VPERMI2Q", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x76,0xc8}},
+	{"VPERMI2Q", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x76,0xc8}},
+	{"VPERMI2PS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x77,0xc8}},
+	{"VPERMI2PS", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x77,0xc8}},
+	{"VPERMI2PS", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x77,0xc8}},
+	{"VPERMI2PD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x77,0xc8}},
+	{"VPERMI2PD", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x77,0xc8}},
+	{"VPERMI2PD", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x77,0xc8}},
+	{"VCVTTPD2UDQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfc,0x08,0x78,0xc8}},
+	{"VCVTTPD2UDQ", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfc,0x28,0x78,0xc8}},
+	{"VCVTTPD2UDQ", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfc,0x48,0x78,0xc8}},
+	{"VCVTTPS2UDQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x78,0xc8}},
+	{"VCVTTPS2UDQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x78,0xc8}},
+	{"VCVTTPS2UDQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x78,0xc8}},
+	{"VCVTTPS2UQQ", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0x78,0xc8}},
+	{"VCVTTPS2UQQ", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0x78,0xc8}},
+	{"VCVTTPS2UQQ", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0x78,0xc8}},
+	{"VCVTTPD2UQQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x78,0xc8}},
+	{"VCVTTPD2UQQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x78,0xc8}},
+	{"VCVTTPD2UQQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x78,0xc8}},
+	{"VPBROADCASTB", "xmm, xmm/m8", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x78,0xc8}},
+	{"VPBROADCASTB", "ymm, xmm/m8", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x78,0xc8}},
+	{"VPBROADCASTB", "zmm, xmm/m8", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x78,0xc8}},
+	{"VCVTTSD2USI", "r32, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x78,0xc8}},
+	{"VCVTTSD2USI", "r64, xmm/m64", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x78,0xc8}},
+	{"VCVTTSS2USI", "r32, xmm/m32", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x78,0xc8}},
+	{"VCVTTSS2USI", "r64, xmm/m32", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x78,0xc8}},
+	{"VCVTPS2UDQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7c,0x08,0x79,0xc8}},
+	{"VCVTPS2UDQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7c,0x28,0x79,0xc8}},
+	{"VCVTPS2UDQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7c,0x48,0x79,0xc8}},
+	{"VCVTPD2UDQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfc,0x08,0x79,0xc8}},
+	{"VCVTPD2UDQ", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfc,0x28,0x79,0xc8}},
+	{"VCVTPD2UDQ", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfc,0x48,0x79,0xc8}},
+	{"VCVTPS2UQQ", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0x79,0xc8}},
+	{"VCVTPS2UQQ", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0x79,0xc8}},
+	{"VCVTPS2UQQ", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0x79,0xc8}},
+	{"VCVTPD2UQQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x79,0xc8}},
+	{"VCVTPD2UQQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x79,0xc8}},
+	{"VCVTPD2UQQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x79,0xc8}},
+	{"VPBROADCASTW", "xmm, xmm/m16", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x79,0xc8}},
+	{"VPBROADCASTW", "ymm, xmm/m16", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x79,0xc8}},
+	{"VPBROADCASTW", "zmm, xmm/m16", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x79,0xc8}},
+	{"VCVTSD2USI", "r32, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x79,0xc8}},
+	{"VCVTSD2USI", "r64, xmm/m64", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x79,0xc8}},
+	{"VCVTSS2USI", "r32, xmm/m32", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x79,0xc8}},
+	{"VCVTSS2USI", "r64, xmm/m32", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x79,0xc8}},
+	{"VCVTTPS2QQ", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0x7a,0xc8}},
+	{"VCVTTPS2QQ", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0x7a,0xc8}},
+	{"VCVTTPS2QQ", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0x7a,0xc8}},
+	{"VCVTTPD2QQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x7a,0xc8}},
+	{"VCVTTPD2QQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x7a,0xc8}},
+	{"VCVTTPD2QQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x7a,0xc8}},
+	{"VPBROADCASTB", "xmm, r8", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x7a,0xc8}},
+	{"VPBROADCASTB", "ymm, r8", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x7a,0xc8}},
+	{"VPBROADCASTB", "zmm, r8", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x7a,0xc8}},
+	{"VCVTUDQ2PS", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x7a,0xc8}},
+	{"VCVTUDQ2PS", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7f,0x28,0x7a,0xc8}},
+	{"VCVTUDQ2PS", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x7f,0x48,0x7a,0xc8}},
+	{"VCVTUQQ2PS", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x7a,0xc8}},
+	{"VCVTUQQ2PS", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xff,0x28,0x7a,0xc8}},
+	{"VCVTUQQ2PS", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xff,0x48,0x7a,0xc8}},
+	{"VCVTUDQ2PD", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x7a,0xc8}},
+	{"VCVTUDQ2PD", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7e,0x28,0x7a,0xc8}},
+	{"VCVTUDQ2PD", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7e,0x48,0x7a,0xc8}},
+	{"VCVTUQQ2PD", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x7a,0xc8}},
+	{"VCVTUQQ2PD", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfe,0x28,0x7a,0xc8}},
+	{"VCVTUQQ2PD", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfe,0x48,0x7a,0xc8}},
+	{"VCVTPS2QQ", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0x7b,0xc8}},
+	{"VCVTPS2QQ", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0x7b,0xc8}},
+	{"VCVTPS2QQ", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0x7b,0xc8}},
+	{"VCVTPD2QQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x7b,0xc8}},
+	{"VCVTPD2QQ", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x7b,0xc8}},
+	{"VCVTPD2QQ", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x7b,0xc8}},
+	{"VPBROADCASTW", "xmm, r16", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x7b,0xc8}},
+	{"VPBROADCASTW", "ymm, r16", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x7b,0xc8}},
+	{"VPBROADCASTW", "zmm, r16", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x7b,0xc8}},
+	{"VCVTUSI2SD", "xmm, xmm, r/m32", "ir_function", 6, {0x62,0xf1,0x6f,0x08,0x7b,0xc8}},
+	{"VCVTUSI2SD", "xmm, xmm, r/m64", "ir_function", 6, {0x62,0xf1,0xef,0x08,0x7b,0xc8}},
+	{"VCVTUSI2SS", "xmm, xmm, r/m32", "ir_function", 6, {0x62,0xf1,0x6e,0x08,0x7b,0xc8}},
+	{"VCVTUSI2SS", "xmm, xmm, r/m64", "ir_function", 6, {0x62,0xf1,0xee,0x08,0x7b,0xc8}},
+	{"VPBROADCASTD", "xmm, r32", "ir_function", 6, {0x62,0xf2,0x7d,0x08,0x7c,0xc8}},
+	{"VPBROADCASTD", "ymm, r32", "ir_function", 6, {0x62,0xf2,0x7d,0x28,0x7c,0xc8}},
+	{"VPBROADCASTD", "zmm, r32", "ir_function", 6, {0x62,0xf2,0x7d,0x48,0x7c,0xc8}},
+	{"VPBROADCASTQ", "xmm, r64", "ir_function", 6, {0x62,0xf2,0xfd,0x08,0x7c,0xc8}},
+	{"VPBROADCASTQ", "ymm, r64", "ir_function", 6, {0x62,0xf2,0xfd,0x28,0x7c,0xc8}},
+	{"VPBROADCASTQ", "zmm, r64", "ir_function", 6, {0x62,0xf2,0xfd,0x48,0x7c,0xc8}},
+	{"VPERMT2B", "xmm, xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x7d,0xc8}},
+	{"VPERMT2B", "ymm, ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x7d,0xc8}},
+	{"VPERMT2B", "zmm, zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x7d,0xc8}},
+	{"VPERMT2W", "xmm, xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x7d,0xc8}},
+	{"VPERMT2W", "ymm, ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x7d,0xc8}},
+	{"VPERMT2W", "zmm, zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x7d,0xc8}},
+	{"VMOVD", "r/m32, xmm", "native", 6, {0x62,0xf1,0x7d,0x08,0x7e,0xc8}},
+	{"VMOVQ", "r/m64, xmm", "native", 6, {0x62,0xf1,0xfd,0x08,0x7e,0xc8}},
+	{"VPERMT2D", "xmm, xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x7e,0xc8}},
+	{"VPERMT2D", "ymm, ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x7e,0xc8}},
+	{"VPERMT2D", "zmm, zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x7e,0xc8}},
+	{"VPERMT2Q", "xmm, xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x7e,0xc8}},
+	{"VPERMT2Q", "ymm, ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x7e,0xc8}},
+	{"VPERMT2Q", "zmm, zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x7e,0xc8}},
+	{"VMOVQ", "xmm, xmm/m64", "native", 6, {0x62,0xf1,0xfe,0x08,0x7e,0xc8}},
+	{"VMOVDQA64", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0x7f,0xc8}},
+	{"VMOVDQA64", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0x7f,0xc8}},
+	{"VMOVDQA64", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0x7f,0xc8}},
+	{"VMOVDQA32", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0x7f,0xc8}},
+	{"VMOVDQA32", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0x7f,0xc8}},
+	{"VMOVDQA32", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0x7f,0xc8}},
+	{"VPERMT2PS", "xmm, xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x7f,0xc8}},
+	{"VPERMT2PS", "ymm, ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x7f,0xc8}},
+	{"VPERMT2PS", "zmm, zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x7f,0xc8}},
+	{"VPERMT2PD", "xmm, xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x7f,0xc8}},
+	{"VPERMT2PD", "ymm, ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x7f,0xc8}},
+	{"VPERMT2PD", "zmm, zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x7f,0xc8}},
+	{"VMOVDQU8", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x7f,0x08,0x7f,0xc8}},
+	{"VMOVDQU8", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x7f,0x28,0x7f,0xc8}},
+	{"VMOVDQU8", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x7f,0x48,0x7f,0xc8}},
+	{"VMOVDQU16", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xff,0x08,0x7f,0xc8}},
+	{"VMOVDQU16", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xff,0x28,0x7f,0xc8}},
+	{"VMOVDQU16", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xff,0x48,0x7f,0xc8}},
+	{"VMOVDQU32", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0x7f,0xc8}},
+	{"VMOVDQU32", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0x7e,0x28,0x7f,0xc8}},
+	{"VMOVDQU32", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0x7e,0x48,0x7f,0xc8}},
+	{"VMOVDQU64", "xmm/m128, xmm", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0x7f,0xc8}},
+	{"VMOVDQU64", "ymm/m256, ymm", "ir_function", 6, {0x62,0xf1,0xfe,0x28,0x7f,0xc8}},
+	{"VMOVDQU64", "zmm/m512, zmm", "ir_function", 6, {0x62,0xf1,0xfe,0x48,0x7f,0xc8}},
+	{"VPMULTISHIFTQB", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x83,0xc8}},
+	{"VPMULTISHIFTQB", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x83,0xc8}},
+	{"VPMULTISHIFTQB", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x83,0xc8}},
+	{"VEXPANDPS", "xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x7d,0x08,0x88,0xc8}},
+	{"VEXPANDPS", "ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x7d,0x28,0x88,0xc8}},
+	{"VEXPANDPS", "zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x7d,0x48,0x88,0xc8}},
+	{"VEXPANDPD", "xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xfd,0x08,0x88,0xc8}},
+	{"VEXPANDPD", "ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xfd,0x28,0x88,0xc8}},
+	{"VEXPANDPD", "zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xfd,0x48,0x88,0xc8}},
+	{"VPEXPANDD", "xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x7d,0x08,0x89,0xc8}},
+	{"VPEXPANDD", "ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x7d,0x28,0x89,0xc8}},
+	{"VPEXPANDD", "zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x7d,0x48,0x89,0xc8}},
+	{"VPEXPANDQ", "xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xfd,0x08,0x89,0xc8}},
+	{"VPEXPANDQ", "ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xfd,0x28,0x89,0xc8}},
+	{"VPEXPANDQ", "zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xfd,0x48,0x89,0xc8}},
+	{"VCOMPRESSPS", "xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x7d,0x08,0x8a,0xc8}},
+	{"VCOMPRESSPS", "ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x7d,0x28,0x8a,0xc8}},
+	{"VCOMPRESSPS", "zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x7d,0x48,0x8a,0xc8}},
+	{"VCOMPRESSPD", "xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xfd,0x08,0x8a,0xc8}},
+	{"VCOMPRESSPD", "ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xfd,0x28,0x8a,0xc8}},
+	{"VCOMPRESSPD", "zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xfd,0x48,0x8a,0xc8}},
+	{"VPCOMPRESSD", "xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x7d,0x08,0x8b,0xc8}},
+	{"VPCOMPRESSD", "ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x7d,0x28,0x8b,0xc8}},
+	{"VPCOMPRESSD", "zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x7d,0x48,0x8b,0xc8}},
+	{"VPCOMPRESSQ", "xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xfd,0x08,0x8b,0xc8}},
+	{"VPCOMPRESSQ", "ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xfd,0x28,0x8b,0xc8}},
+	{"VPCOMPRESSQ", "zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xfd,0x48,0x8b,0xc8}},
+	{"VPERMB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf2,0x6d,0x08,0x8d,0xc8}},
+	{"VPERMB", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x8d,0xc8}},
+	{"VPERMB", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x8d,0xc8}},
+	{"VPERMW", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0x8d,0xc8}},
+	{"VPERMW", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0x8d,0xc8}},
+	{"VPERMW", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0x8d,0xc8}},
+	{"VPSHUFBITQMB", "k, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0x8f,0xc8}},
+	{"VPSHUFBITQMB", "k, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x6d,0x28,0x8f,0xc8}},
+	{"VPSHUFBITQMB", "k, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x6d,0x48,0x8f,0xc8}},
+	{"KMOVW", "k, k/m16", "ir_function", 5, {0xc4,0xe1,0x78,0x90,0xc8}},
+	{"KMOVQ", "k, k/m64", "ir_function", 5, {0xc4,0xe1,0xf8,0x90,0xc8}},
+	{"KMOVB", "k, k/m8", "ir_function", 5, {0xc4,0xe1,0x79,0x90,0xc8}},
+	{"KMOVD", "k, k/m32", "ir_function", 5, {0xc4,0xe1,0xf9,0x90,0xc8}},
+	{"KMOVW", "m16, k", "ir_function", 5, {0xc4,0xe1,0x78,0x91,0x0f}},
+	{"KMOVQ", "m64, k", "ir_function", 5, {0xc4,0xe1,0xf8,0x91,0x0f}},
+	{"KMOVB", "m8, k", "ir_function", 5, {0xc4,0xe1,0x79,0x91,0x0f}},
+	{"KMOVD", "m32, k", "ir_function", 5, {0xc4,0xe1,0xf9,0x91,0x0f}},
+	{"KMOVW", "k, r16", "ir_function", 5, {0xc4,0xe1,0x78,0x92,0xc8}},
+	{"KMOVB", "k, r8", "ir_function", 5, {0xc4,0xe1,0x79,0x92,0xc8}},
+	{"KMOVD", "k, r32", "ir_function", 5, {0xc4,0xe1,0x7b,0x92,0xc8}},
+	{"KMOVQ", "k, r64", "ir_function", 5, {0xc4,0xe1,0xfb,0x92,0xc8}},
+	{"KMOVW", "r16, k", "ir_function", 5, {0xc4,0xe1,0x78,0x93,0xc8}},
+	{"KMOVB", "r8, k", "ir_function", 5, {0xc4,0xe1,0x79,0x93,0xc8}},
+	{"KMOVD", "r32, k", "ir_function", 5, {0xc4,0xe1,0x7b,0x93,0xc8}},
+	{"KMOVQ", "r64, k", "ir_function", 5, {0xc4,0xe1,0xfb,0x93,0xc8}},
+	{"VFMADDSUB132PS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x96,0xc8}},
+	{"VFMADDSUB132PS", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0x96,0xc8}},
+	{"VFMADDSUB132PS", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0x96,0xc8}},
+	{"VFMADDSUB132PD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x96,0xc8}},
+	{"VFMADDSUB132PD", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0x96,0xc8}},
+	{"VFMADDSUB132PD", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0x96,0xc8}},
+	{"VFMSUBADD132PS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x97,0xc8}},
+	{"VFMSUBADD132PS", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0x97,0xc8}},
+	{"VFMSUBADD132PS", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0x97,0xc8}},
+	{"VFMSUBADD132PD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x97,0xc8}},
+	{"VFMSUBADD132PD", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0x97,0xc8}},
+	{"VFMSUBADD132PD", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0x97,0xc8}},
+	{"KORTESTW", "k, k", "ir_function", 5, {0xc4,0xe1,0x78,0x98,0xc8}},
+	{"KORTESTQ", "k, k", "ir_function", 5, {0xc4,0xe1,0xf8,0x98,0xc8}},
+	{"KORTESTB", "k, k", "ir_function", 5, {0xc4,0xe1,0x79,0x98,0xc8}},
+	{"KORTESTD", "k, k", "ir_function", 5, {0xc4,0xe1,0xf9,0x98,0xc8}},
+	{"VFMADD132PS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x98,0xc8}},
+	{"VFMADD132PS", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0x98,0xc8}},
+	{"VFMADD132PS", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0x98,0xc8}},
+	{"VFMADD132PD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x98,0xc8}},
+	{"VFMADD132PD", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0x98,0xc8}},
+	{"VFMADD132PD", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0x98,0xc8}},
+	{"KTESTW", "k, k", "ir_function", 5, {0xc4,0xe1,0x78,0x99,0xc8}},
+	{"KTESTQ", "k, k", "ir_function", 5, {0xc4,0xe1,0xf8,0x99,0xc8}},
+	{"KTESTB", "k, k", "ir_function", 5, {0xc4,0xe1,0x79,0x99,0xc8}},
+	{"KTESTD", "k, k", "ir_function", 5, {0xc4,0xe1,0xf9,0x99,0xc8}},
+	{"VFMADD132SS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x99,0xc8}},
+	{"VFMADD132SD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x99,0xc8}},
+	{"VFMSUB132PS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x9a,0xc8}},
+	{"VFMSUB132PS", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0x9a,0xc8}},
+	{"VFMSUB132PS", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0x9a,0xc8}},
+	{"VFMSUB132PD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x9a,0xc8}},
+	{"VFMSUB132PD", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0x9a,0xc8}},
+	{"VFMSUB132PD", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0x9a,0xc8}},
+	{"VFMSUB132SS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x9b,0xc8}},
+	{"VFMSUB132SD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x9b,0xc8}},
+	{"VFNMADD132PS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x9c,0xc8}},
+	{"VFNMADD132PS", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0x9c,0xc8}},
+	{"VFNMADD132PS", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0x9c,0xc8}},
+	{"VFNMADD132PD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x9c,0xc8}},
+	{"VFNMADD132PD", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0x9c,0xc8}},
+	{"VFNMADD132PD", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0x9c,0xc8}},
+	{"VFNMADD132SS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x9d,0xc8}},
+	{"VFNMADD132SD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x9d,0xc8}},
+	{"VFNMSUB132PS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x9e,0xc8}},
+	{"VFNMSUB132PS", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0x9e,0xc8}},
+	{"VFNMSUB132PS", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0x9e,0xc8}},
+	{"VFNMSUB132PD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x9e,0xc8}},
+	{"VFNMSUB132PD", "ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0x9e,0xc8}},
+	{"VFNMSUB132PD", "zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0x9e,0xc8}},
+	{"VFNMSUB132SS", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0x9f,0xc8}},
+	{"VFNMSUB132SD", "xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0x9f,0xc8}},
+	{"VFMADDSUB213PS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xa6,0xc8}},
+	{"VFMADDSUB213PS", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0xa6,0xc8}},
+	{"VFMADDSUB213PS", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0xa6,0xc8}},
+	{"VFMADDSUB213PD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xa6,0xc8}},
+	{"VFMADDSUB213PD", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0xa6,0xc8}},
+	{"VFMADDSUB213PD", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0xa6,0xc8}},
+	{"VFMSUBADD213PS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xa7,0xc8}},
+	{"VFMSUBADD213PS", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0xa7,0xc8}},
+	{"VFMSUBADD213PS", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0xa7,0xc8}},
+	{"VFMSUBADD213PD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xa7,0xc8}},
+	{"VFMSUBADD213PD", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0xa7,0xc8}},
+	{"VFMSUBADD213PD", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0xa7,0xc8}},
+	{"VFMADD213PS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xa8,0xc8}},
+	{"VFMADD213PS", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0xa8,0xc8}},
+	{"VFMADD213PS", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0xa8,0xc8}},
+	{"VFMADD213PD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xa8,0xc8}},
+	{"VFMADD213PD", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0xa8,0xc8}},
+	{"VFMADD213PD", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0xa8,0xc8}},
+	{"VFMADD213SS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xa9,0xc8}},
+	{"VFMADD213SD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xa9,0xc8}},
+	{"VFMSUB213PS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xaa,0xc8}},
+	{"VFMSUB213PS", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0xaa,0xc8}},
+	{"VFMSUB213PS", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0xaa,0xc8}},
+	{"VFMSUB213PD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xaa,0xc8}},
+	{"VFMSUB213PD", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0xaa,0xc8}},
+	{"VFMSUB213PD", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0xaa,0xc8}},
+	{"VFMSUB213SS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xab,0xc8}},
+	{"VFMSUB213SD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xab,0xc8}},
+	{"VFNMADD213PS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xac,0xc8}},
+	{"VFNMADD213PS", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0xac,0xc8}},
+	{"VFNMADD213PS", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0xac,0xc8}},
+	{"VFNMADD213PD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xac,0xc8}},
+	{"VFNMADD213PD", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0xac,0xc8}},
+	{"VFNMADD213PD", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0xac,0xc8}},
+	{"VFNMADD213SS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xad,0xc8}},
+	{"VFNMADD213SD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xad,0xc8}},
+	{"VFNMSUB213PS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xae,0xc8}},
+	{"VFNMSUB213PS", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0x6d,0x28,0xae,0xc8}},
+	{"VFNMSUB213PS", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0x6d,0x48,0xae,0xc8}},
+	{"VFNMSUB213PD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xae,0xc8}},
+	{"VFNMSUB213PD", "ymm, ymm, ymm, ymm/m256", "manual", 6, {0x62,0xf2,0xed,0x28,0xae,0xc8}},
+	{"VFNMSUB213PD", "zmm, zmm, zmm, zmm/m512", "manual", 6, {0x62,0xf2,0xed,0x48,0xae,0xc8}},
+	{"VFNMSUB213SS", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0x6d,0x08,0xaf,0xc8}},
+	{"VFNMSUB213SD", "xmm, xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf2,0xed,0x08,0xaf,0xc8}},
+	{"VPMADD52LUQ", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0xb4,0xc8}},
+	{"VPMADD52LUQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0xb4,0xc8}},
+	{"VPMADD52LUQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0xb4,0xc8}},
+	{"VPMADD52HUQ", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0xb5,0xc8}},
+	{"VPMADD52HUQ", "ymm, ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xed,0x28,0xb5,0xc8}},
+	{"VPMADD52HUQ", "zmm, zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xed,0x48,0xb5,0xc8}},
+	{"VFMADDSUB231PS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xb6,0xc8}},
+	{"VFMADDSUB231PS", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0xb6,0xc8}},
+	{"VFMADDSUB231PS", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0xb6,0xc8}},
+	{"VFMADDSUB231PD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xb6,0xc8}},
+	{"VFMADDSUB231PD", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0xb6,0xc8}},
+	{"VFMADDSUB231PD", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0xb6,0xc8}},
+	{"VFMSUBADD231PS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xb7,0xc8}},
+	{"VFMSUBADD231PS", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0xb7,0xc8}},
+	{"VFMSUBADD231PS", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0xb7,0xc8}},
+	{"VFMSUBADD231PD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xb7,0xc8}},
+	{"VFMSUBADD231PD", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0xb7,0xc8}},
+	{"VFMSUBADD231PD", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0xb7,0xc8}},
+	{"VFMADD231PS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xb8,0xc8}},
+	{"VFMADD231PS", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0xb8,0xc8}},
+	{"VFMADD231PS", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0xb8,0xc8}},
+	{"VFMADD231PD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xb8,0xc8}},
+	{"VFMADD231PD", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0xb8,0xc8}},
+	{"VFMADD231PD", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0xb8,0xc8}},
+	{"VFMADD231SS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xb9,0xc8}},
+	{"VFMADD231SD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xb9,0xc8}},
+	{"VFMSUB231PS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xba,0xc8}},
+	{"VFMSUB231PS", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0xba,0xc8}},
+	{"VFMSUB231PS", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0xba,0xc8}},
+	{"VFMSUB231PD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xba,0xc8}},
+	{"VFMSUB231PD", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0xba,0xc8}},
+	{"VFMSUB231PD", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0xba,0xc8}},
+	{"VFMSUB231SS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xbb,0xc8}},
+	{"VFMSUB231SD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xbb,0xc8}},
+	{"VFNMADD231PS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xbc,0xc8}},
+	{"VFNMADD231PS", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0xbc,0xc8}},
+	{"VFNMADD231PS", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0xbc,0xc8}},
+	{"VFNMADD231PD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xbc,0xc8}},
+	{"VFNMADD231PD", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0xbc,0xc8}},
+	{"VFNMADD231PD", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0xbc,0xc8}},
+	{"VFNMADD231SS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xbd,0xc8}},
+	{"VFNMADD231SD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xbd,0xc8}},
+	{"VFNMSUB231PS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xbe,0xc8}},
+	{"VFNMSUB231PS", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0x6d,0x28,0xbe,0xc8}},
+	{"VFNMSUB231PS", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0x6d,0x48,0xbe,0xc8}},
+	{"VFNMSUB231PD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xbe,0xc8}},
+	{"VFNMSUB231PD", "ymm, ymm, ymm/m256, ymm", "manual", 6, {0x62,0xf2,0xed,0x28,0xbe,0xc8}},
+	{"VFNMSUB231PD", "zmm, zmm, zmm/m512, zmm", "manual", 6, {0x62,0xf2,0xed,0x48,0xbe,0xc8}},
+	{"VFNMSUB231SS", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0x6d,0x08,0xbf,0xc8}},
+	{"VFNMSUB231SD", "xmm, xmm, xmm/m128, xmm", "manual", 6, {0x62,0xf2,0xed,0x08,0xbf,0xc8}},
+	{"VCMPPS", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf1,0x6c,0x08,0xc2,0xc8,0x01}},
+	{"VCMPPS", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf1,0x6c,0x28,0xc2,0xc8,0x01}},
+	{"VCMPPS", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf1,0x6c,0x48,0xc2,0xc8,0x01}},
+	{"VCMPPD", "k, xmm, xmm/m128, imm8", "helper", 7, {0x62,0xf1,0xed,0x08,0xc2,0xc8,0x01}},
+	{"VCMPPD", "k, ymm, ymm/m256, imm8", "helper", 7, {0x62,0xf1,0xed,0x28,0xc2,0xc8,0x01}},
+	{"VCMPPD", "k, zmm, zmm/m512, imm8", "helper", 7, {0x62,0xf1,0xed,0x48,0xc2,0xc8,0x01}},
+	{"VCMPSS", "k, xmm, xmm/m32, imm8", "ir_function", 7, {0x62,0xf1,0x6e,0x08,0xc2,0xc8,0x01}},
+	{"VCMPSD", "k, xmm, xmm/m64, imm8", "ir_function", 7, {0x62,0xf1,0xef,0x08,0xc2,0xc8,0x01}},
+	{"VPINSRW", "xmm, xmm, r/m16, imm8", "ir_function", 7, {0x62,0xf1,0x6d,0x08,0xc4,0xc8,0x01}},
+	{"VPCONFLICTD", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x7d,0x08,0xc4,0xc8}},
+	{"VPCONFLICTD", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0x7d,0x28,0xc4,0xc8}},
+	{"VPCONFLICTD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0xc4,0xc8}},
+	{"VPCONFLICTQ", "xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xfd,0x08,0xc4,0xc8}},
+	{"VPCONFLICTQ", "ymm, ymm/m256", "helper", 6, {0x62,0xf2,0xfd,0x28,0xc4,0xc8}},
+	{"VPCONFLICTQ", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0xc4,0xc8}},
+	{"VPEXTRW", "r16, xmm, imm8", "manual", 7, {0x62,0xf1,0x7d,0x08,0xc5,0xc8,0x01}},
+	{"VSHUFPS", "xmm, xmm/m128, xmm, imm8", "ir_function", 7, {0x62,0xf1,0x6c,0x08,0xc6,0xc8,0x01}},
+	{"VSHUFPS", "ymm, ymm/m256, ymm, imm8", "ir_function", 7, {0x62,0xf1,0x6c,0x28,0xc6,0xc8,0x01}},
+	{"VSHUFPS", "zmm, zmm/m512, zmm, imm8", "ir_function", 7, {0x62,0xf1,0x6c,0x48,0xc6,0xc8,0x01}},
+	{"VSHUFPD", "xmm, xmm/m128, xmm, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x08,0xc6,0xc8,0x01}},
+	{"VSHUFPD", "ymm, ymm/m256, ymm, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x28,0xc6,0xc8,0x01}},
+	{"VSHUFPD", "zmm, zmm/m512, zmm, imm8", "ir_function", 7, {0x62,0xf1,0xed,0x48,0xc6,0xc8,0x01}},
+	{"VEXP2PS", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0xc8,0xc8}},
+	{"VEXP2PD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0xc8,0xc8}},
+	{"VRCP28PS", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0xca,0xc8}},
+	{"VRCP28PD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0xca,0xc8}},
+	{"VRCP28SS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0xcb,0xc8}},
+	{"VRCP28SD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0xcb,0xc8}},
+	{"VRSQRT28PS", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0x7d,0x48,0xcc,0xc8}},
+	{"VRSQRT28PD", "zmm, zmm/m512", "helper", 6, {0x62,0xf2,0xfd,0x48,0xcc,0xc8}},
+	{"VRSQRT28SS", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0x6d,0x08,0xcd,0xc8}},
+	{"VRSQRT28SD", "xmm, xmm, xmm/m128", "helper", 6, {0x62,0xf2,0xed,0x08,0xcd,0xc8}},
+	{"VGF2P8AFFINEQB", "xmm, xmm, xmm/m128, imm8", "isel", 6, {0xc4,0xe3,0xe9,0xce,0xc8,0x01}},
+	{"VGF2P8AFFINEQB", "ymm, ymm, ymm/m256, imm8", "isel", 6, {0xc4,0xe3,0xe9,0xce,0xc8,0x01}},
+	{"VGF2P8AFFINEQB", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0xed,0x08,0xce,0xc8,0x01}},
+	{"VGF2P8AFFINEQB", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0xed,0x28,0xce,0xc8,0x01}},
+	{"VGF2P8AFFINEQB", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0xed,0x48,0xce,0xc8,0x01}},
+	{"GF2P8MULB", "xmm, xmm, xmm/m128", "isel", 5, {0xc4,0xe2,0xe9,0xcf,0xc8}},
+	{"GF2P8MULB", "ymm, ymm, ymm/m256", "isel", 5, {0xc4,0xe2,0xe9,0xcf,0xc8}},
+	{"GF2P8MULB", "xmm, xmm, xmm/m128", "isel", 6, {0x62,0xf2,0xed,0x08,0xcf,0xc8}},
+	{"GF2P8MULB", "ymm, ymm, ymm/m256", "isel", 6, {0x62,0xf2,0xed,0x28,0xcf,0xc8}},
+	{"GF2P8MULB", "zmm, zmm, zmm/m512", "isel", 6, {0x62,0xf2,0xed,0x48,0xcf,0xc8}},
+	{"VGF2P8AFFINEINVQB", "xmm, xmm, xmm/m128, imm8", "isel", 6, {0xc4,0xe3,0xe9,0xcf,0xc8,0x01}},
+	{"VGF2P8AFFINEINVQB", "ymm, ymm, ymm/m256, imm8", "isel", 6, {0xc4,0xe3,0xe9,0xcf,0xc8,0x01}},
+	{"VGF2P8AFFINEINVQB", "xmm, xmm, xmm/m128, imm8", "isel", 7, {0x62,0xf3,0xed,0x08,0xcf,0xc8,0x01}},
+	{"VGF2P8AFFINEINVQB", "ymm, ymm, ymm/m256, imm8", "isel", 7, {0x62,0xf3,0xed,0x28,0xcf,0xc8,0x01}},
+	{"VGF2P8AFFINEINVQB", "zmm, zmm, zmm/m512, imm8", "isel", 7, {0x62,0xf3,0xed,0x48,0xcf,0xc8,0x01}},
+	{"VPSRLW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x08,0xd1,0xc8}},
+	{"VPSRLW", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x28,0xd1,0xc8}},
+	{"VPSRLW", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x48,0xd1,0xc8}},
+	{"VPSRLD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x08,0xd2,0xc8}},
+	{"VPSRLD", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x28,0xd2,0xc8}},
+	{"VPSRLD", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x48,0xd2,0xc8}},
+	{"VPSRLQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x08,0xd3,0xc8}},
+	{"VPSRLQ", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x28,0xd3,0xc8}},
+	{"VPSRLQ", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x48,0xd3,0xc8}},
+	{"VPADDQ", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0xd4,0xc8}},
+	{"VPADDQ", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0xd4,0xc8}},
+	{"VPADDQ", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0xd4,0xc8}},
+	{"VPMULLW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xd5,0xc8}},
+	{"VPMULLW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xd5,0xc8}},
+	{"VPMULLW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xd5,0xc8}},
+	{"VMOVQ", "xmm/m64, xmm", "native", 6, {0x62,0xf1,0xfd,0x08,0xd6,0xc8}},
+	{"VPSUBUSB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xd8,0xc8}},
+	{"VPSUBUSB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xd8,0xc8}},
+	{"VPSUBUSB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xd8,0xc8}},
+	{"VPSUBUSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xd9,0xc8}},
+	{"VPSUBUSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xd9,0xc8}},
+	{"VPSUBUSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xd9,0xc8}},
+	{"VPMINUB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xda,0xc8}},
+	{"VPMINUB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xda,0xc8}},
+	{"VPMINUB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xda,0xc8}},
+	{"VPANDD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xdb,0xc8}},
+	{"VPANDD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xdb,0xc8}},
+	{"VPANDD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xdb,0xc8}},
+	{"VPANDQ", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0xdb,0xc8}},
+	{"VPANDQ", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0xdb,0xc8}},
+	{"VPANDQ", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0xdb,0xc8}},
+	{"VPADDUSB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xdc,0xc8}},
+	{"VPADDUSB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xdc,0xc8}},
+	{"VPADDUSB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xdc,0xc8}},
+	{"VPADDUSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xdd,0xc8}},
+	{"VPADDUSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xdd,0xc8}},
+	{"VPADDUSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xdd,0xc8}},
+	{"VPMAXUB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xde,0xc8}},
+	{"VPMAXUB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xde,0xc8}},
+	{"VPMAXUB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xde,0xc8}},
+	{"VPANDND", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x6d,0x08,0xdf,0xc8}},
+	{"VPANDND", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x6d,0x28,0xdf,0xc8}},
+	{"VPANDND", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x6d,0x48,0xdf,0xc8}},
+	{"VPANDNQ", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xed,0x08,0xdf,0xc8}},
+	{"VPANDNQ", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xed,0x28,0xdf,0xc8}},
+	{"VPANDNQ", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xed,0x48,0xdf,0xc8}},
+	{"VPAVGB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xe0,0xc8}},
+	{"VPAVGB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xe0,0xc8}},
+	{"VPAVGB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xe0,0xc8}},
+	{"VPSRAW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x08,0xe1,0xc8}},
+	{"VPSRAW", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x28,0xe1,0xc8}},
+	{"VPSRAW", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x48,0xe1,0xc8}},
+	{"VPSRAD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x08,0xe2,0xc8}},
+	{"VPSRAD", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x28,0xe2,0xc8}},
+	{"VPSRAD", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x48,0xe2,0xc8}},
+	{"VPSRAQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x08,0xe2,0xc8}},
+	{"VPSRAQ", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x28,0xe2,0xc8}},
+	{"VPSRAQ", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x48,0xe2,0xc8}},
+	{"VPAVGW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xe3,0xc8}},
+	{"VPAVGW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xe3,0xc8}},
+	{"VPAVGW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xe3,0xc8}},
+	{"VPMULHUW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xe4,0xc8}},
+	{"VPMULHUW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xe4,0xc8}},
+	{"VPMULHUW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xe4,0xc8}},
+	{"VPMULHW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xe5,0xc8}},
+	{"VPMULHW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xe5,0xc8}},
+	{"VPMULHW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xe5,0xc8}},
+	{"VCVTTPD2DQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfd,0x08,0xe6,0xc8}},
+	{"VCVTTPD2DQ", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfd,0x28,0xe6,0xc8}},
+	{"VCVTTPD2DQ", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfd,0x48,0xe6,0xc8}},
+	{"VCVTPD2DQ", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xff,0x08,0xe6,0xc8}},
+	{"VCVTPD2DQ", "xmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xff,0x28,0xe6,0xc8}},
+	{"VCVTPD2DQ", "ymm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xff,0x48,0xe6,0xc8}},
+	{"VCVTDQ2PD", "xmm, xmm/m64", "ir_function", 6, {0x62,0xf1,0x7e,0x08,0xe6,0xc8}},
+	{"VCVTDQ2PD", "ymm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x7e,0x28,0xe6,0xc8}},
+	{"VCVTDQ2PD", "zmm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x7e,0x48,0xe6,0xc8}},
+	{"VCVTQQ2PD", "xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xfe,0x08,0xe6,0xc8}},
+	{"VCVTQQ2PD", "ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xfe,0x28,0xe6,0xc8}},
+	{"VCVTQQ2PD", "zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xfe,0x48,0xe6,0xc8}},
+	{"VMOVNTDQ", "m128, xmm", "ir_function", 6, {0x62,0xf1,0x7d,0x08,0xe7,0x0f}},
+	{"VMOVNTDQ", "m256, ymm", "ir_function", 6, {0x62,0xf1,0x7d,0x28,0xe7,0x0f}},
+	{"VMOVNTDQ", "m512, zmm", "ir_function", 6, {0x62,0xf1,0x7d,0x48,0xe7,0x0f}},
+	{"VPSUBSB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xe8,0xc8}},
+	{"VPSUBSB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xe8,0xc8}},
+	{"VPSUBSB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xe8,0xc8}},
+	{"VPSUBSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xe9,0xc8}},
+	{"VPSUBSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xe9,0xc8}},
+	{"VPSUBSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xe9,0xc8}},
+	{"VPMINSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xea,0xc8}},
+	{"VPMINSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xea,0xc8}},
+	{"VPMINSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xea,0xc8}},
+	{"VPORD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xeb,0xc8}},
+	{"VPORD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xeb,0xc8}},
+	{"VPORD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xeb,0xc8}},
+	{"VPORQ", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0xeb,0xc8}},
+	{"VPORQ", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0xeb,0xc8}},
+	{"VPORQ", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0xeb,0xc8}},
+	{"VPADDSB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xec,0xc8}},
+	{"VPADDSB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xec,0xc8}},
+	{"VPADDSB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xec,0xc8}},
+	{"VPADDSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xed,0xc8}},
+	{"VPADDSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xed,0xc8}},
+	{"VPADDSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xed,0xc8}},
+	{"VPMAXSW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xee,0xc8}},
+	{"VPMAXSW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xee,0xc8}},
+	{"VPMAXSW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xee,0xc8}},
+	{"VPXORD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xef,0xc8}},
+	{"VPXORD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xef,0xc8}},
+	{"VPXORD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xef,0xc8}},
+	{"VPXORQ", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0xef,0xc8}},
+	{"VPXORQ", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0xef,0xc8}},
+	{"VPXORQ", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0xef,0xc8}},
+	{"VPSLLW", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x08,0xf1,0xc8}},
+	{"VPSLLW", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x28,0xf1,0xc8}},
+	{"VPSLLW", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x48,0xf1,0xc8}},
+	{"VPSLLD", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x08,0xf2,0xc8}},
+	{"VPSLLD", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x28,0xf2,0xc8}},
+	{"VPSLLD", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0x6d,0x48,0xf2,0xc8}},
+	{"VPSLLQ", "xmm, xmm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x08,0xf3,0xc8}},
+	{"VPSLLQ", "ymm, ymm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x28,0xf3,0xc8}},
+	{"VPSLLQ", "zmm, zmm, xmm/m128", "manual", 6, {0x62,0xf1,0xed,0x48,0xf3,0xc8}},
+	{"VPMULUDQ", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0xed,0x08,0xf4,0xc8}},
+	{"VPMULUDQ", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0xed,0x28,0xf4,0xc8}},
+	{"VPMULUDQ", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0xed,0x48,0xf4,0xc8}},
+	{"VPMADDWD", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x6d,0x08,0xf5,0xc8}},
+	{"VPMADDWD", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x6d,0x28,0xf5,0xc8}},
+	{"VPMADDWD", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x6d,0x48,0xf5,0xc8}},
+	{"VPSADBW", "xmm, xmm, xmm/m128", "ir_function", 6, {0x62,0xf1,0x6d,0x08,0xf6,0xc8}},
+	{"VPSADBW", "ymm, ymm, ymm/m256", "ir_function", 6, {0x62,0xf1,0x6d,0x28,0xf6,0xc8}},
+	{"VPSADBW", "zmm, zmm, zmm/m512", "ir_function", 6, {0x62,0xf1,0x6d,0x48,0xf6,0xc8}},
+	{"VPSUBB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xf8,0xc8}},
+	{"VPSUBB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xf8,0xc8}},
+	{"VPSUBB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xf8,0xc8}},
+	{"VPSUBW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xf9,0xc8}},
+	{"VPSUBW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xf9,0xc8}},
+	{"VPSUBW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xf9,0xc8}},
+	{"VPSUBD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xfa,0xc8}},
+	{"VPSUBD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xfa,0xc8}},
+	{"VPSUBD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xfa,0xc8}},
+	{"VPSUBQ", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0xed,0x08,0xfb,0xc8}},
+	{"VPSUBQ", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0xed,0x28,0xfb,0xc8}},
+	{"VPSUBQ", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0xed,0x48,0xfb,0xc8}},
+	{"VPADDB", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xfc,0xc8}},
+	{"VPADDB", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xfc,0xc8}},
+	{"VPADDB", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xfc,0xc8}},
+	{"VPADDW", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xfd,0xc8}},
+	{"VPADDW", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xfd,0xc8}},
+	{"VPADDW", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xfd,0xc8}},
+	{"VPADDD", "xmm, xmm, xmm/m128", "native", 6, {0x62,0xf1,0x6d,0x08,0xfe,0xc8}},
+	{"VPADDD", "ymm, ymm, ymm/m256", "native", 6, {0x62,0xf1,0x6d,0x28,0xfe,0xc8}},
+	{"VPADDD", "zmm, zmm, zmm/m512", "native", 6, {0x62,0xf1,0x6d,0x48,0xfe,0xc8}},
+};
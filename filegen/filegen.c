@@ -52,6 +52,140 @@ char* IRType_to_var (char* IRType) {
 
 #define NUM_ELEM (26+1)
 
+// How the decoder translates an instruction form, as recorded in the master file
+const char* translation_class () {
+   // Composed of existing IRs by an asm->IR function in guest_amd64_toIR_AVX512.c
+   if (data.IR_function[0] != '\0' && strcmp(data.IR_function, "NULL"))
+      return "ir_function";
+   // No IR: the instruction is parsed by hand in dis_EVEX_exceptions
+   if (data.IR[0] == '\0' || !strcmp(data.IR, "Iop_INVALID"))
+      return "manual";
+   // Existing IR with an existing amd64 translation
+   if (!strcmp(data.asm_function, "LEGACY"))
+      return "native";
+   // Calls the helper h_<IR>
+   if (!strcmp(data.asm_function, "DEFAULT"))
+      return "helper";
+   // Translated by hand in host_amd64_isel_AVX512.c
+   return "isel";
+}
+
+// Number of helper calls made for each execution of the instruction
+int helper_calls () {
+   if (strcmp(translation_class(), "helper"))
+      return 0;
+   // negative multipliers use part of the result of a single 512-bit IR
+   return data.multiplier < 0 ? 1 : data.multiplier;
+}
+
+int type_bits (const char* IRType) {
+   if(!strcmp(IRType, "Ity_V512")) return 512;
+   if(!strcmp(IRType, "Ity_V256")) return 256;
+   if(!strcmp(IRType, "Ity_V128")) return 128;
+   if(!strcmp(IRType, "Ity_I64"))  return 64;
+   if(!strcmp(IRType, "Ity_I32"))  return 32;
+   if(!strcmp(IRType, "Ity_I16"))  return 16;
+   if(!strcmp(IRType, "Ity_I8"))   return 8;
+   return 0;
+}
+
+// Append Intel-style name of an operand, such as "zmm/m512", to form
+void print_operand (char* form, const char* enc, const char* IRType) {
+   int bits = type_bits(IRType);
+   const char* vec = bits == 512 ? "zmm" : bits == 256 ? "ymm" : "xmm";
+   char op[32];
+
+   if (enc[0] == '\0' || !strcmp(enc, "rmode"))
+      return;
+   if (!strcmp(enc, "imm8"))
+      sprintf(op, "imm8");
+   else if (!strcmp(enc, "vm32") || !strcmp(enc, "vm64"))
+      sprintf(op, "%s", enc);
+   else if (!strcmp(enc, "mE") || !strcmp(enc, "mG"))
+      sprintf(op, "m%d", bits);
+   else if (enc[0] == 'k')
+      sprintf(op, enc[1] == 'm' ? "k/m%d" : "k", bits);
+   else if (enc[0] == 'i')
+      sprintf(op, enc[1] == 'm' ? "r/m%d" : "r%d", bits);
+   else if (!strcmp(enc, "rmE"))
+      sprintf(op, "%s/m%d", vec, bits);
+   else
+      sprintf(op, "%s", vec);
+
+   if (form[0] != '\0')
+      strcat(form, ", ");
+   strcat(form, op);
+}
+
+// Registers used by the benchmark encodings: ModRM.reg, VEX.vvvv, ModRM.rm
+#define BENCH_REG_G 1
+#define BENCH_REG_V 2
+#define BENCH_REG_E 0
+#define BENCH_IMM8  0x01
+
+/* Encode the instruction form with its register operands in zmm1/k1/rcx
+   (G), zmm2/k2/rdx (V) and zmm0/k0/rax (E), and its memory operand at
+   [rdi].  Returns the length of the encoding, or 0 if the form cannot be
+   benchmarked this way (VSIB, prefetches, non-VEX instructions). */
+int encode_form (unsigned char* out, const char* vec_pfx) {
+   const char* encs[5] = { data.dst_e, data.src1_e, data.src2_e, data.src3_e, data.src4_e };
+   const char* types[5] = { data.dst_t, data.src1_t, data.src2_t, data.src3_t, data.src4_t };
+   int reg = 0, vvvv = -1, mod = 3, imm = 0, vl = 0, n = 0;
+   // Instructions on mask registers are always VEX encoded
+   int is_evex = !strcmp(vec_pfx, "EVEX") && data.name[0] != 'K';
+
+   if (strcmp(vec_pfx, "EVEX") && strcmp(vec_pfx, "VEX"))
+      return 0;
+   if (data.dst_e[0] == '\0')
+      return 0;
+   for (int i = 0; i < 5; i++) {
+      const char* e = encs[i];
+      if (!strcmp(e, "vm32") || !strcmp(e, "vm64") || !strcmp(e, "mG"))
+         return 0;
+      if (e[0] != '\0' && e[1] == 'G')
+         reg = BENCH_REG_G;
+      else if (e[0] != '\0' && e[1] == 'V')
+         vvvv = BENCH_REG_V;
+      else if (!strcmp(e, "mE"))
+         mod = 0;
+      else if (!strcmp(e, "imm8"))
+         imm = 1;
+      int bits = type_bits(types[i]);
+      if (e[0] == 'r' && bits == 256 && vl < 1) vl = 1;
+      if (e[0] == 'r' && bits == 512) vl = 2;
+   }
+   // "/<digit>" is an opcode extension in ModRM.reg, or the /is4 payload
+   if (data.misc[0] == '/' && reg == 0)
+      reg = data.misc[1] - '0';
+
+   int mm = !strcmp(data.escape, "ESC_0F38") ? 2 : !strcmp(data.escape, "ESC_0F3A") ? 3 : 1;
+   int pp = !strcmp(data.prefix, "PFX_66") ? 1 : !strcmp(data.prefix, "PFX_F3") ? 2 :
+            !strcmp(data.prefix, "PFX_F2") ? 3 : 0;
+   int w = !strcmp(data.width, "W1");
+   int v = vvvv < 0 ? 0xF : (~vvvv & 0xF);
+
+   if (is_evex) {
+      out[n++] = 0x62;
+      out[n++] = 0xF0 | mm;                      // R, X, B, R' inverted
+      out[n++] = (w << 7) | (v << 3) | 0x4 | pp;
+      out[n++] = (vl << 5) | 0x8;                // no masking, V' inverted
+   } else {
+      // Mask logic instructions are VEX.L1, the rest of VEX.L0
+      int l = !strncmp(data.name, "KAND", 4) ||
+              (!strncmp(data.name, "KOR", 3) && strncmp(data.name, "KORTEST", 7)) ||
+              !strncmp(data.name, "KXOR", 4) || !strncmp(data.name, "KXNOR", 5) ||
+              !strncmp(data.name, "KADD", 4) || !strncmp(data.name, "KUNPCK", 6);
+      out[n++] = 0xC4;
+      out[n++] = 0xE0 | mm;
+      out[n++] = (w << 7) | (v << 3) | (l << 2) | pp;
+   }
+   out[n++] = data.opcode;
+   out[n++] = mod == 3 ? (0xC0 | (reg << 3) | BENCH_REG_E) : ((reg << 3) | 7);
+   if (imm)
+      out[n++] = BENCH_IMM8;
+   return n;
+}
+
 void clean_data(){
    memset (&data, 0, sizeof(data));
    data.opcode = -1;
@@ -110,6 +244,8 @@ int main() {
    FILE* guest_main  = fopen("guest_AVX512.h", "w");
    FILE* host_main   = fopen("host_AVX512.h", "w");
    FILE* host_funcs  = fopen("host_generic_AVX512.h", "w");
+   FILE* coverage    = fopen("avx512_coverage.csv", "w");
+   FILE* forms       = fopen("avx512_forms.h", "w");
 
    // print header file info and structure definitions
    fprintf(libvex, "#ifdef AVX_512\n"
@@ -208,6 +344,13 @@ int main() {
          "#include <libvex_basictypes.h>\n"
          );
 
+   fprintf(coverage, "name,form,opcode,prefix,escape,width,class,IR,mult,helper_calls\n");
+   fprintf(forms, "/* This file is auto-generated by \"filegen\" script */\n"
+         "/* DO NOT MODIFY */\n"
+         "\n"
+         "/* name | form | translation class | encoding length | encoding */\n"
+         "static const struct avx512_form FORMS[] = {\n");
+
    // parse and write the data
    // for simplicity, ignore the duplicates for now and remove them later with a shell script
 
@@ -236,7 +379,8 @@ int main() {
       int k = 0;
       strcpy(data.name,   line_elems[k]);
       sscanf(line_elems[++k], "0x%x", &data.opcode);
-      k += 1; // skip VEX/EVEX prefix for now
+      char vec_pfx[8];
+      strcpy(vec_pfx, line_elems[++k]);
       strcpy(data.prefix, line_elems[++k]);
       strcpy(data.escape, line_elems[++k]);
       strcpy(data.width,  line_elems[++k]);
@@ -312,6 +456,32 @@ int main() {
          if (data.src3_t[0] != '\0') fprintf(guest_main, ",%s", data.src3_t);
          if (data.src4_t[0] != '\0') fprintf(guest_main, ",%s", data.src4_t);
          fprintf(guest_main, "}},\n");
+
+         // Describe the form and its translation in the coverage manifest
+         char form[128] = "";
+         print_operand(form, data.dst_e, data.dst_t);
+         const char* srcs_e[4] = { data.src1_e, data.src2_e, data.src3_e, data.src4_e };
+         const char* srcs_t[4] = { data.src1_t, data.src2_t, data.src3_t, data.src4_t };
+         for (int i = 0; i < 4; i++) {
+            // a destination that is also a source is only shown once
+            if (i == 0 && !strcmp(srcs_e[i], data.dst_e))
+               continue;
+            print_operand(form, srcs_e[i], srcs_t[i]);
+         }
+         fprintf(coverage, "%s,\"%s\",0x%x,%s,%s,%s,%s,%s,%d,%d\n",
+               data.name, form, data.opcode, data.prefix, data.escape, data.width,
+               translation_class(), data.IR, data.multiplier, helper_calls());
+
+         // Add the encoding of the form to the benchmark table
+         unsigned char bytes[16];
+         int len = encode_form(bytes, vec_pfx);
+         if (len > 0) {
+            fprintf(forms, "\t{\"%s\", \"%s\", \"%s\", %d, {", data.name, form,
+                  translation_class(), len);
+            for (int i = 0; i < len; i++)
+               fprintf(forms, "%s0x%02x", i ? "," : "", bytes[i]);
+            fprintf(forms, "}},\n");
+         }
       }
 
       // If we declare a new IR to assembly translation, add it to host and Memcheck files
@@ -390,7 +560,11 @@ int main() {
          "#endif /* ndef __VEX_HOST_GENERIC_AVX512_H */\n"
          "#endif /* ndef AVX_512*/\n");
 
+   fprintf(forms, "};\n");
+
    fclose(master);
+   fclose(coverage);
+   fclose(forms);
    fclose(libvex);
    fclose(guest_main);
    fclose(host_main);
@@ -110,6 +110,12 @@ extern Bool  HG_(clo_delta_stacktrace);
    amd 10 million.  Default is 1 million. */
 extern UWord HG_(clo_conflict_cache_size);
 
+/* When doing "full" history collection, the maximum number of bytes
+   used by the conflicting-access cache and the stack traces it refers
+   to.  The least recently used accesses are discarded first.  0 (the
+   default) means that only HG_(clo_conflict_cache_size) limits it. */
+extern SizeT HG_(clo_history_budget);
+
 /* Sanity check level.  This is an or-ing of
    SCE_{THREADS,LOCKS,BIGRANGE,ACCESS,LAOG}. */
 extern UWord HG_(clo_sanity_flags);
@@ -133,6 +139,12 @@ extern Bool HG_(clo_free_is_write);
       mostly a big time waster, but minimises space use. */
 extern UWord HG_(clo_vts_pruning);
 
+/* Maximum time in microseconds that one slice of the incremental VTS
+   garbage collection may take.  The collection of a big VTS table is
+   spread over as many slices as needed.  0 means no limit: each
+   collection then sweeps the whole table in one go.  Default: 10000. */
+extern UWord HG_(clo_vts_gc_budget);
+
 /* When False, race checking ignores memory references which are to
    the stack, which speeds things up a bit.  Default: True. */
 extern Bool HG_(clo_check_stack_refs); 
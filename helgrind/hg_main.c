@@ -5805,6 +5805,29 @@ static Bool hg_process_cmd_line_option ( const HChar* arg )
    else if VG_BINT_CLO(arg, "--conflict-cache-size",
                        HG_(clo_conflict_cache_size), 10*1000, 150*1000*1000) {}
 
+   /* <number>[k|m|g] --> number of bytes */
+   else if VG_STR_CLO(arg, "--history-budget", tmp_str) {
+      HChar* end;
+      Long   n = VG_(strtoll10)( tmp_str, &end );
+      Long   mult;
+
+      switch (*end) {
+         case '\0':           mult = 1;                  break;
+         case 'k': case 'K': mult = 1024;               break;
+         case 'm': case 'M': mult = 1024 * 1024;        break;
+         case 'g': case 'G': mult = 1024 * 1024 * 1024; break;
+         default:            mult = 0;                  break;
+      }
+      if (end == tmp_str || n < 0 || mult == 0
+          || (*end != '\0' && end[1] != '\0')
+          || n > (Long)((~0ULL >> 1) / mult)) {
+         VG_(fmsg_bad_option)(arg,
+            "--history-budget must be a number of bytes,"
+            " optionally followed by k, m or g\n");
+      }
+      HG_(clo_history_budget) = (SizeT)n * mult;
+   }
+
    /* "stuvwx" --> stuvwx (binary) */
    else if VG_STR_CLO(arg, "--hg-sanity-flags", tmp_str) {
       Int j;
@@ -5835,6 +5858,8 @@ static Bool hg_process_cmd_line_option ( const HChar* arg )
                             HG_(clo_vts_pruning), 1);
    else if VG_XACT_CLO(arg, "--vts-pruning=always",
                             HG_(clo_vts_pruning), 2);
+   else if VG_BINT_CLO(arg, "--vts-gc-budget",
+                            HG_(clo_vts_gc_budget), 0, 10*1000*1000) {}
 
    else if VG_BOOL_CLO(arg, "--check-stack-refs",
                             HG_(clo_check_stack_refs)) {}
@@ -5863,6 +5888,8 @@ static void hg_print_usage ( void )
 "        yes : derive a stacktrace from the previous stacktrace\n"
 "          if there was no call/return or similar instruction\n"
 "    --conflict-cache-size=N   size of 'full' history cache [2000000]\n"
+"    --history-budget=<number>[k|m|g]  max memory for 'full' history,\n"
+"                              0 for no limit [0]\n"
 "    --check-stack-refs=no|yes race-check reads and writes on the\n"
 "                              main stack and thread stacks? [yes]\n"
 "    --ignore-thread-creation=yes|no Ignore activities during thread\n"
@@ -5890,6 +5917,8 @@ static void hg_print_debug_usage ( void )
 "       never:   is never done (may cause big space leaks in Helgrind)\n"
 "       auto:    done just often enough to keep space usage under control\n"
 "       always:  done after every VTS GC (mostly just a big time waster)\n"
+"    --vts-gc-budget=<number>  max microseconds spent in one slice of\n"
+"       the incremental VTS GC, 0 for no limit [10000]\n"
     );
 }
 
@@ -47,6 +47,7 @@
 #include "pub_tool_debuginfo.h"
 #include "pub_tool_gdbserver.h"
 #include "pub_tool_options.h"        // VG_(clo_stats)
+#include "pub_tool_libcproc.h"       // VG_(read_microsecond_timer)
 #include "hg_basics.h"
 #include "hg_wordset.h"
 #include "hg_lock_n_thread.h"
@@ -671,6 +672,16 @@ static UWord stats__vts__cmpLEQ          = 0; // # calls to VTS__cmpLEQ
 static UWord stats__vts__cmp_structural  = 0; // # calls to VTS__cmp_structural
 static UWord stats__vts_tab_GC           = 0; // # nr of vts_tab GC
 static UWord stats__vts_pruning          = 0; // # nr of vts pruning
+static UWord stats__vts_tab_GC_slices    = 0; // # nr of vts_tab GC slices
+
+// Pause times of the vts_tab GC slices and of the vts prunings.
+// Entry i counts the pauses shorter than 2^(i+4) microseconds (and
+// not counted in entry i-1); the last entry counts all longer pauses.
+#define N_VTS_PAUSE_HIST 20
+static UWord stats__vts_tab_GC_pauses[N_VTS_PAUSE_HIST];
+static UWord stats__vts_pruning_pauses[N_VTS_PAUSE_HIST];
+static ULong stats__vts_tab_GC_max_pause  = 0; // in microseconds
+static ULong stats__vts_pruning_max_pause = 0; // in microseconds
 
 // # calls to VTS__cmp_structural w/ slow case
 static UWord stats__vts__cmp_structural_slow = 0;
@@ -2737,14 +2748,61 @@ static void VTS__declare_thread_very_dead ( Thr* thr )
 //                                                     //
 /////////////////////////////////////////////////////////
 
-static WordFM* /* WordFM VTS* void */ vts_set = NULL;
+/* The set is split into N_VTS_SET_SHARDS WordFMs, selected by a hash
+   of the VTS contents.  Lookups are frequent (one for each join and
+   each tick) and each step of the tree search does a full structural
+   compare of two vector clocks, which gets expensive with many
+   threads.  Sharding keeps the trees shallow, and the hash is cheap
+   compared to even a single structural compare. */
+#define N_VTS_SET_SHARDS 256
+
+static WordFM* /* WordFM VTS* void */ vts_set[N_VTS_SET_SHARDS];
+
+static void vts_set__new ( WordFM** set, const HChar* cc )
+{
+   UWord i;
+   for (i = 0; i < N_VTS_SET_SHARDS; i++) {
+      set[i] = VG_(newFM)( HG_(zalloc), cc,
+                           HG_(free),
+                           (Word(*)(UWord,UWord))VTS__cmp_structural );
+   }
+}
+
+static void vts_set__delete ( WordFM** set )
+{
+   UWord i;
+   for (i = 0; i < N_VTS_SET_SHARDS; i++) {
+      VG_(deleteFM)( set[i], NULL/*kFin*/, NULL/*vFin*/ );
+      set[i] = NULL;
+   }
+}
+
+static UWord vts_set__size ( WordFM** set )
+{
+   UWord i, n = 0;
+   for (i = 0; i < N_VTS_SET_SHARDS; i++)
+      n += VG_(sizeFM)( set[i] );
+   return n;
+}
+
+/* Return the shard of 'set' which holds VTSs structurally identical
+   to 'vts'. */
+static WordFM* vts_set__shard ( WordFM** set, const VTS* vts )
+{
+   ULong h = 0x9E3779B97F4A7C15ULL * (ULong)(vts->usedTS + 1);
+   UInt  i;
+   for (i = 0; i < vts->usedTS; i++) {
+      h ^= ((ULong)vts->ts[i].thrid << 40) ^ (ULong)vts->ts[i].tym;
+      h *= 0xFF51AFD7ED558CCDULL;
+      h ^= h >> 29;
+   }
+   return set[(h >> 32) % N_VTS_SET_SHARDS];
+}
 
 static void vts_set_init ( void )
 {
-   tl_assert(!vts_set);
-   vts_set = VG_(newFM)( HG_(zalloc), "libhb.vts_set_init.1",
-                         HG_(free),
-                         (Word(*)(UWord,UWord))VTS__cmp_structural );
+   tl_assert(!vts_set[0]);
+   vts_set__new( vts_set, "libhb.vts_set_init.1" );
 }
 
 /* Given a VTS, look in vts_set to see if we already have a
@@ -2754,10 +2812,11 @@ static void vts_set_init ( void )
 static Bool vts_set__find__or__clone_and_add ( /*OUT*/VTS** res, VTS* cand )
 {
    UWord keyW, valW;
+   WordFM* shard = vts_set__shard( vts_set, cand );
    stats__vts_set__focaa++;
    tl_assert(cand->id == VtsID_INVALID);
    /* lookup cand (by value) */
-   if (VG_(lookupFM)( vts_set, &keyW, &valW, (UWord)cand )) {
+   if (VG_(lookupFM)( shard, &keyW, &valW, (UWord)cand )) {
       /* found it */
       tl_assert(valW == 0);
       /* if this fails, cand (by ref) was already present (!) */
@@ -2769,7 +2828,7 @@ static Bool vts_set__find__or__clone_and_add ( /*OUT*/VTS** res, VTS* cand )
       stats__vts_set__focaa_a++;
       VTS* clone = VTS__clone( "libhb.vts_set_focaa.1", cand );
       tl_assert(clone != cand);
-      VG_(addToFM)( vts_set, (UWord)clone, 0/*val is unused*/ );
+      VG_(addToFM)( shard, (UWord)clone, 0/*val is unused*/ );
       *res = clone;
       return False;
    }
@@ -2926,12 +2985,39 @@ static VtsID vts_tab__find__or__clone_and_add ( VTS* cand )
 }
 
 
+static void record_vts_pause ( /*MOD*/UWord* hist, /*MOD*/ULong* max,
+                               ULong us )
+{
+   UInt b = 0;
+   while (b < N_VTS_PAUSE_HIST - 1 && us >= (1ULL << (b + 4)))
+      b++;
+   hist[b]++;
+   if (us > *max)
+      *max = us;
+}
+
+static void show_vts_pauses ( const HChar* what,
+                              const UWord* hist, ULong max )
+{
+   UInt b;
+   VG_(printf)("    %s pauses (max %llu us):", what, max);
+   for (b = 0; b < N_VTS_PAUSE_HIST; b++) {
+      if (hist[b] == 0)
+         continue;
+      if (b < N_VTS_PAUSE_HIST - 1)
+         VG_(printf)(" <%lluus:%lu", 1ULL << (b + 4), hist[b]);
+      else
+         VG_(printf)(" >=%lluus:%lu", 1ULL << (b + 3), hist[b]);
+   }
+   VG_(printf)("\n");
+}
+
 static void show_vts_stats ( const HChar* caller )
 {
    UWord nSet, nTab, nLive;
    ULong totrc;
    UWord n, i;
-   nSet = VG_(sizeFM)( vts_set );
+   nSet = vts_set__size( vts_set );
    nTab = VG_(sizeXA)( vts_tab );
    totrc = 0;
    nLive = 0;
@@ -2950,6 +3036,10 @@ static void show_vts_stats ( const HChar* caller )
    VG_(printf)("    vts_tab live %4lu\n", nLive);
    VG_(printf)("    vts_set size %4lu\n", nSet);
    VG_(printf)("        total rc %4llu\n", totrc);
+   show_vts_pauses("GC slice", stats__vts_tab_GC_pauses,
+                   stats__vts_tab_GC_max_pause);
+   show_vts_pauses(" pruning", stats__vts_pruning_pauses,
+                   stats__vts_pruning_max_pause);
 }
 
 
@@ -2992,11 +3082,34 @@ void remap_VtsIDs_in_SVal ( /*MOD*/XArray* /* of VtsTE */ old_tab,
 }
 
 
+/* Remove 'vts' from vts_set.  It must be there. */
+static void vts_set__remove ( VTS* vts )
+{
+   UWord oldK = 0, oldV = 12345;
+   Bool  present = VG_(delFromFM)( vts_set__shard( vts_set, vts ),
+                                   &oldK, &oldV, (UWord)vts );
+   tl_assert(present); /* else it isn't in vts_set ?! */
+   tl_assert(oldV == 0); /* no info stored in vts_set val fields */
+   tl_assert(oldK == (UWord)vts); /* else what did delFromFM find?! */
+}
+
+/* The VTS GC is incremental: a GC cycle sweeps vts_tab from its start
+   to its end, but each call of vts_tab__do_GC only sweeps a slice of
+   it, stopping once HG_(clo_vts_gc_budget) microseconds have elapsed.
+   The next slice is done the next time the freelist runs dry.  Only
+   when a cycle is complete is the next GC point recomputed and the
+   pruning considered.  vts_GC_cursor is the next entry to sweep, or
+   zero if no cycle is in progress. */
+static UWord vts_GC_cursor = 0;
+static UWord vts_GC_nLive  = 0; /* entries kept so far in this cycle */
+
 /* NOT TO BE CALLED FROM WITHIN libzsm. */
 __attribute__((noinline))
 static void vts_tab__do_GC ( Bool show_stats )
 {
-   UWord i, nTab, nLive, nFreed;
+   UWord i, nTab, nLive;
+   ULong budget  = HG_(clo_vts_gc_budget);
+   ULong t_start = VG_(read_microsecond_timer)();
 
    /* ---------- BEGIN VTS GC ---------- */
    /* check this is actually necessary. */
@@ -3012,48 +3125,62 @@ static void vts_tab__do_GC ( Bool show_stats )
 
    nTab = VG_(sizeXA)( vts_tab );
 
-   if (show_stats) {
-      VG_(printf)("<<GC begins at vts_tab size %lu>>\n", nTab);
-      show_vts_stats("before GC");
+   if (vts_GC_cursor == 0) {
+      vts_GC_nLive = 0;
+      if (show_stats) {
+         VG_(printf)("<<GC begins at vts_tab size %lu>>\n", nTab);
+         show_vts_stats("before GC");
+      }
    }
 
-   /* Now we can inspect the entire vts_tab.  Any entries with zero
-      .rc fields are now no longer in use and can be put back on the
-      free list, removed from vts_set, and deleted. */
-   nFreed = 0;
-   for (i = 0; i < nTab; i++) {
-      Bool present;
-      UWord oldK = 0, oldV = 12345;
+   /* Now we can inspect vts_tab.  Any entries with zero .rc fields are
+      now no longer in use and can be put back on the free list,
+      removed from vts_set, and deleted.  Look at the clock every 1024
+      entries, and leave the rest of the table for the next slice when
+      over budget.  Each slice sweeps at least 1024 entries, so that the
+      cycle progresses even if the cache flush alone is over budget. */
+   for (i = vts_GC_cursor; i < nTab; i++) {
+      if (budget > 0 && i > vts_GC_cursor && ((i - vts_GC_cursor) & 1023) == 0
+          && VG_(read_microsecond_timer)() - t_start >= budget) {
+         break;
+      }
       VtsTE* te = VG_(indexXA)( vts_tab, i );
       if (te->vts == NULL) {
          tl_assert(te->rc == 0);
          continue; /* already on the free list (presumably) */
       }
-      if (te->rc > 0)
+      if (te->rc > 0) {
+         vts_GC_nLive++;
          continue; /* in use */
+      }
       /* Ok, we got one we can free. */
       tl_assert(te->vts->id == i);
       /* first, remove it from vts_set. */
-      present = VG_(delFromFM)( vts_set,
-                                &oldK, &oldV, (UWord)te->vts );
-      tl_assert(present); /* else it isn't in vts_set ?! */
-      tl_assert(oldV == 0); /* no info stored in vts_set val fields */
-      tl_assert(oldK == (UWord)te->vts); /* else what did delFromFM find?! */
+      vts_set__remove(te->vts);
       /* now free the VTS itself */
       VTS__delete(te->vts);
       te->vts = NULL;
       /* and finally put this entry on the free list */
       tl_assert(te->u.freelink == VtsID_INVALID); /* can't already be on it */
       add_to_free_list( i );
-      nFreed++;
    }
 
+   stats__vts_tab_GC_slices++;
+   if (i < nTab) {
+      /* Out of time.  The rest of the cycle is for the next slices. */
+      vts_GC_cursor = i;
+      record_vts_pause( stats__vts_tab_GC_pauses,
+                        &stats__vts_tab_GC_max_pause,
+                        VG_(read_microsecond_timer)() - t_start );
+      return;
+   }
+   vts_GC_cursor = 0;
+
    /* Now figure out when the next GC should be.  We'll allow the
       number of VTSs to double before GCing again.  Except of course
       that since we can't (or, at least, don't) shrink vts_tab, we
       can't set the threshold value smaller than it. */
-   tl_assert(nFreed <= nTab);
-   nLive = nTab - nFreed;
+   nLive = vts_GC_nLive;
    tl_assert(nLive <= nTab);
    vts_next_GC_at = 2 * nLive;
    if (vts_next_GC_at < nTab)
@@ -3072,6 +3199,9 @@ static void vts_tab__do_GC ( Bool show_stats )
                    stats__vts_tab_GC, 
                    nTab, nLive, (100ULL * (ULong)nLive) / (ULong)nTab);
    }
+   record_vts_pause( stats__vts_tab_GC_pauses,
+                     &stats__vts_tab_GC_max_pause,
+                     VG_(read_microsecond_timer)() - t_start );
    /* ---------- END VTS GC ---------- */
 
    /* Decide whether to do VTS pruning.  We have one of three
@@ -3102,6 +3232,8 @@ static void vts_tab__do_GC ( Bool show_stats )
       return;
 
    /* ---------- BEGIN VTS PRUNING ---------- */
+   t_start = VG_(read_microsecond_timer)();
+
    /* Sort and check the very dead threads that died since the last pruning.
       Sorting is used for the check and so that we can quickly look
       up the dead-thread entries as we work through the VTSs. */
@@ -3118,11 +3250,9 @@ static void vts_tab__do_GC ( Bool show_stats )
       = VG_(newXA)( HG_(zalloc), "libhb.vts_tab__do_GC.new_tab",
                     HG_(free), sizeof(VtsTE) );
 
-   /* WordFM VTS* void */
-   WordFM* new_set
-      = VG_(newFM)( HG_(zalloc), "libhb.vts_tab__do_GC.new_set",
-                    HG_(free),
-                    (Word(*)(UWord,UWord))VTS__cmp_structural );
+   /* WordFM VTS* void, sharded like vts_set */
+   WordFM* new_set[N_VTS_SET_SHARDS];
+   vts_set__new( new_set, "libhb.vts_tab__do_GC.new_set" );
 
    /* Visit each old VTS.  For each one:
 
@@ -3150,9 +3280,15 @@ static void vts_tab__do_GC ( Bool show_stats )
       VtsTE* old_te  = VG_(indexXA)( vts_tab, i );
       VTS*   old_vts = old_te->vts;
 
-      /* Skip it if not in use */
+      /* Skip it if not in use.  Entries swept by an earlier slice of
+         the GC cycle may have lost their last reference since then;
+         get rid of those now. */
       if (old_te->rc == 0) {
-         tl_assert(old_vts == NULL);
+         if (old_vts != NULL) {
+            vts_set__remove(old_vts);
+            VTS__delete(old_vts);
+            old_te->vts = NULL;
+         }
          continue;
       }
       tl_assert(old_te->u.remap == VtsID_INVALID);
@@ -3174,12 +3310,7 @@ static void vts_tab__do_GC ( Bool show_stats )
          them all after we're done, but the upside is that we don't
          wind up temporarily storing potentially two complete copies
          of each VTS and hence spiking memory use. */
-      UWord oldK = 0, oldV = 12345;
-      Bool  present = VG_(delFromFM)( vts_set,
-                                      &oldK, &oldV, (UWord)old_vts );
-      tl_assert(present); /* else it isn't in vts_set ?! */
-      tl_assert(oldV == 0); /* no info stored in vts_set val fields */
-      tl_assert(oldK == (UWord)old_vts); /* else what did delFromFM find?! */
+      vts_set__remove(old_vts);
       /* now free the VTS itself */
       VTS__delete(old_vts);
       old_te->vts = NULL;
@@ -3193,7 +3324,8 @@ static void vts_tab__do_GC ( Bool show_stats )
          it. */
       VTS*  identical_version = NULL;
       UWord valW = 12345;
-      if (VG_(lookupFM)(new_set, (UWord*)&identical_version, &valW,
+      WordFM* new_shard = vts_set__shard( new_set, new_vts );
+      if (VG_(lookupFM)(new_shard, (UWord*)&identical_version, &valW,
                         (UWord)new_vts)) {
          // already have it
          tl_assert(valW == 0);
@@ -3206,7 +3338,7 @@ static void vts_tab__do_GC ( Bool show_stats )
          tl_assert(valW == 12345);
          tl_assert(identical_version == NULL);
          new_vts->id = new_VtsID_ctr++;
-         Bool b = VG_(addToFM)(new_set, (UWord)new_vts, 0);
+         Bool b = VG_(addToFM)(new_shard, (UWord)new_vts, 0);
          tl_assert(!b);
          VtsTE new_te;
          new_te.vts      = new_vts;
@@ -3248,7 +3380,7 @@ static void vts_tab__do_GC ( Bool show_stats )
         == VtsID_INVALID. 
       * the new VTS tree.
    */
-   tl_assert( VG_(sizeFM)(vts_set) == 0 );
+   tl_assert( vts_set__size(vts_set) == 0 );
 
    /* Now actually apply the mapping. */
    /* Visit all the VtsIDs in the entire system.  Where do we expect
@@ -3331,8 +3463,9 @@ static void vts_tab__do_GC ( Bool show_stats )
    }
 
    /* Install the new table and set. */
-   VG_(deleteFM)(vts_set, NULL/*kFin*/, NULL/*vFin*/);
-   vts_set = new_set;
+   vts_set__delete(vts_set);
+   for (i = 0; i < N_VTS_SET_SHARDS; i++)
+      vts_set[i] = new_set[i];
    VG_(deleteXA)( vts_tab );
    vts_tab = new_tab;
 
@@ -3344,21 +3477,24 @@ static void vts_tab__do_GC ( Bool show_stats )
    /* Sanity check vts_set and vts_tab. */
 
    /* Because all the live entries got slid down to the bottom of vts_tab: */
-   tl_assert( VG_(sizeXA)( vts_tab ) == VG_(sizeFM)( vts_set ));
+   tl_assert( VG_(sizeXA)( vts_tab ) == vts_set__size( vts_set ));
 
    /* Assert that the vts_tab and vts_set entries point at each other
       in the required way */
    UWord wordK = 0, wordV = 0;
-   VG_(initIterFM)( vts_set );
-   while (VG_(nextIterFM)( vts_set, &wordK, &wordV )) {
-      tl_assert(wordK != 0);
-      tl_assert(wordV == 0);
-      VTS* vts = (VTS*)wordK;
-      tl_assert(vts->id != VtsID_INVALID);
-      VtsTE* te = VG_(indexXA)( vts_tab, vts->id );
-      tl_assert(te->vts == vts);
+   for (i = 0; i < N_VTS_SET_SHARDS; i++) {
+      VG_(initIterFM)( vts_set[i] );
+      while (VG_(nextIterFM)( vts_set[i], &wordK, &wordV )) {
+         tl_assert(wordK != 0);
+         tl_assert(wordV == 0);
+         VTS* vts = (VTS*)wordK;
+         tl_assert(vts->id != VtsID_INVALID);
+         tl_assert(vts_set__shard( vts_set, vts ) == vts_set[i]);
+         VtsTE* te = VG_(indexXA)( vts_tab, vts->id );
+         tl_assert(te->vts == vts);
+      }
+      VG_(doneIterFM)( vts_set[i] );
    }
-   VG_(doneIterFM)( vts_set );
 
    /* Also iterate over the table, and check each entry is
       plausible. */
@@ -3385,6 +3521,9 @@ static void vts_tab__do_GC ( Bool show_stats )
          nAfterPruning, nSTSsAfter / (nAfterPruning ? nAfterPruning : 1)
       );
    }
+   record_vts_pause( stats__vts_pruning_pauses,
+                     &stats__vts_pruning_max_pause,
+                     VG_(read_microsecond_timer)() - t_start );
    /* ---------- END VTS PRUNING ---------- */
 }
 
@@ -4272,6 +4411,12 @@ static inline SVal Ptr2SVal (void* ptr)
       of course decrement the reference count on the RCEC it
       refers to, in order that entries from (1) eventually get
       discarded too.
+
+      With --history-budget, the memory used by (1) and (2) together
+      is also limited: no new OldRef is allocated once the budget is
+      reached, and when the RCECs push the total over the budget, the
+      least recently used OldRefs are discarded until the RCECs they
+      kept alive can be GCed.
 */
 
 static UWord stats__evm__lookup_found = 0;
@@ -4282,6 +4427,7 @@ static UWord stats__ctxt_eq_tsw_neq_rcec = 0;
 static UWord stats__ctxt_neq_tsw_neq_rcec = 0;
 static UWord stats__ctxt_rcdec_calls = 0;
 static UWord stats__ctxt_rcec_gc_discards = 0;
+static UWord stats__evm__budget_discards = 0;
 
 static UWord stats__ctxt_tab_curr = 0;
 static UWord stats__ctxt_tab_max  = 0;
@@ -4820,7 +4966,8 @@ static Word cmp_oldref_tsw (const void* node1, const void* node2 )
 
 //////////// BEGIN OldRef pool allocator
 static PoolAlloc* oldref_pool_allocator;
-// Note: We only allocate elements in this pool allocator, we never free them.
+// Note: We only free elements of this pool allocator to keep within
+// --history-budget.
 // We stop allocating elements at VG_(clo_conflict_cache_size).
 //////////// END OldRef pool allocator
 
@@ -4865,14 +5012,32 @@ static VgHashTable* oldrefHT    = NULL; /* Hash table* OldRef* */
 static UWord     oldrefHTN    = 0;    /* # elems in oldrefHT */
 /* Note: the nr of ref in the oldrefHT will always be equal to
    the nr of elements that were allocated from the OldRef pool allocator
-   as we never free an OldRef : we just re-use them. */
+   as we only free OldRefs to keep within --history-budget, otherwise we
+   just re-use them. */
 
+/* Bytes used by an OldRef (counting its oldrefHT chain slot), and by
+   an RCEC. */
+#define OLDREF_SZB (sizeof(OldRef) + sizeof(OldRef*))
+static inline SizeT RCEC_szB ( void )
+{
+   return sizeof(RCEC) + 2 * HG_(clo_history_backtrace_size) * sizeof(UWord);
+}
+
+/* Memory used by the conflicting-access history.  The RCECs with a
+   zero reference count are included, as they are only freed by the
+   next do_RCEC_GC. */
+static inline SizeT event_map_szB ( void )
+{
+   return oldrefHTN * OLDREF_SZB + stats__ctxt_tab_curr * RCEC_szB();
+}
 
 /* allocates a new OldRef or re-use the lru one if all allowed OldRef
    have already been allocated. */
 static OldRef* alloc_or_reuse_OldRef ( void )
 {
-   if (oldrefHTN < HG_(clo_conflict_cache_size)) {
+   if (oldrefHTN < HG_(clo_conflict_cache_size)
+       && (HG_(clo_history_budget) == 0
+           || event_map_szB() + OLDREF_SZB <= HG_(clo_history_budget))) {
       oldrefHTN++;
       return VG_(allocEltPA) ( oldref_pool_allocator );
    } else {
@@ -5252,6 +5417,37 @@ static void do_RCEC_GC ( void )
    tl_assert (stats__ctxt_tab_curr == RCEC_referenced);
 }
 
+/* If the conflicting-access history uses more than --history-budget,
+   discard the least recently used OldRefs until the OldRefs and the
+   RCECs they still reference use at most 31/32 of the budget, then GC
+   the RCECs that became unreferenced.  Leaving some room avoids doing
+   this again at each call. */
+static void event_map_enforce_budget ( void )
+{
+   const SizeT budget = HG_(clo_history_budget);
+
+   if (budget == 0 || event_map_szB() <= budget)
+      return;
+
+   while (oldrefHTN > 0
+          && oldrefHTN * OLDREF_SZB + RCEC_referenced * RCEC_szB()
+             > budget - budget / 32) {
+      OldRef *oldref_ht;
+      OldRef *oldref = lru.next;
+
+      tl_assert (oldref != &mru);
+      OldRef_unchain(oldref);
+      oldref_ht = VG_(HT_gen_remove) (oldrefHT, oldref, cmp_oldref_tsw);
+      tl_assert (oldref == oldref_ht);
+      ctxt__rcdec( oldref->acc.rcec );
+      VG_(freeEltPA) ( oldref_pool_allocator, oldref );
+      oldrefHTN--;
+      stats__evm__budget_discards++;
+   }
+   if (stats__ctxt_tab_curr > RCEC_referenced)
+      do_RCEC_GC();
+}
+
 /////////////////////////////////////////////////////////
 //                                                     //
 // Core MSM                                            //
@@ -6756,10 +6952,13 @@ void libhb_shutdown ( Bool show_stats )
          "   libhb: %ld entries in vts_table (approximately %lu bytes)\n",
          VG_(sizeXA)( vts_tab ), VG_(sizeXA)( vts_tab ) * sizeof(VtsTE)
       );
-      VG_(printf)("   libhb: #%lu vts_tab GC    #%lu vts pruning\n",
-                  stats__vts_tab_GC, stats__vts_pruning);
+      VG_(printf)("   libhb: #%lu vts_tab GC (%lu slices)"
+                  "    #%lu vts pruning\n",
+                  stats__vts_tab_GC, stats__vts_tab_GC_slices,
+                  stats__vts_pruning);
+      show_vts_stats("at exit");
       VG_(printf)( "   libhb: %lu entries in vts_set\n",
-                   VG_(sizeFM)( vts_set ) );
+                   vts_set__size( vts_set ) );
 
       VG_(printf)("%s","\n");
       {
@@ -6799,6 +6998,10 @@ void libhb_shutdown ( Bool show_stats )
       VG_(printf)("%s","\n");
       VG_(printf)( "   libhb: oldrefHTN %lu (%'d bytes)\n",
                    oldrefHTN, (int)(oldrefHTN * sizeof(OldRef)));
+      VG_(printf)( "   libhb: history %'lu bytes (budget %'lu),"
+                   " %'lu oldref budget discards\n",
+                   (UWord)event_map_szB(), (UWord)HG_(clo_history_budget),
+                   stats__evm__budget_discards);
       tl_assert (oldrefHTN == VG_(HT_count_nodes) (oldrefHT));
       VG_(printf)( "   libhb: oldref lookup found=%lu notfound=%lu\n",
                    stats__evm__lookup_found, stats__evm__lookup_notfound);
@@ -7419,6 +7622,10 @@ void libhb_maybe_GC ( void )
                 && (stats__ctxt_tab_curr * 3)/4 > RCEC_referenced))
       do_RCEC_GC();
 
+   /* Keep the conflicting-access history within --history-budget. */
+   if (UNLIKELY(HG_(clo_history_budget) > 0))
+      event_map_enforce_budget();
+
    /* If there are still no entries available (all the table entries are full),
       and we hit the threshold point, then do a GC */
    Bool vts_tab_GC = vts_tab_freelist == VtsID_INVALID
@@ -101,6 +101,10 @@ extern Int VG_(getegid) ( void );
 // steps).  This is wallclock time.
 extern UInt VG_(read_millisecond_timer) ( void );
 
+// As VG_(read_millisecond_timer), but in microseconds.  Intended for
+// timing short operations, eg. when gathering statistics.
+extern ULong VG_(read_microsecond_timer) ( void );
+
 extern Int  VG_(gettimeofday)(struct vki_timeval *tv, struct vki_timezone *tz);
 
 #  if defined(VGO_linux) || defined(VGO_solaris) || defined(VGO_freebsd)
@@ -1616,6 +1616,12 @@ struct vki_spacectl_range {
 #define VKI_SEEK_CUR              1
 #define VKI_SEEK_END              2
 
+//----------------------------------------------------------------------
+// From sys/fcntl.h
+//----------------------------------------------------------------------
+
+#define VKI_POSIX_FADV_WILLNEED   3
+
 #define VKI_F_OK  0       /* test for existence of file */
 #define VKI_X_OK  0x01    /* test for execute or search permission */
 #define VKI_W_OK  0x02    /* test for write permission */
@@ -628,6 +628,12 @@ typedef struct vki_sigevent {
 #define VKI_SEEK_CUR              1
 #define VKI_SEEK_END              2
 
+//----------------------------------------------------------------------
+// From linux-6.0/include/uapi/linux/fadvise.h
+//----------------------------------------------------------------------
+
+#define VKI_POSIX_FADV_WILLNEED   3 /* will need these pages */
+
 //----------------------------------------------------------------------
 // From linux-2.6.8.1/include/linux/net.h
 //----------------------------------------------------------------------
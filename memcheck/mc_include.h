@@ -517,6 +517,10 @@ extern HChar * MC_(snprintf_delta) (HChar * buf, Int size,
 Bool MC_(is_valid_aligned_word)     ( Addr a );
 Bool MC_(is_within_valid_secondary) ( Addr a );
 
+// Nr of words whose validity MC_(valid_aligned_words_mask) gives.
+#define MC_VALID_WORDS_GROUP (8 * sizeof(UWord))
+UWord MC_(valid_aligned_words_mask) ( Addr a );
+
 // Prints as user msg a description of the given loss record.
 void MC_(pp_LossRecord)(UInt n_this_record, UInt n_total_records,
                         LossRecord* l);
@@ -687,6 +691,10 @@ typedef
    Default : all heuristics. */
 extern UInt MC_(clo_leak_check_heuristics);
 
+/* Remember the root scan of a leak search, to reuse it for the parts of
+   the root set that did not change at the next one?  Default: NO */
+extern Bool MC_(clo_incremental_leak_check);
+
 /* Assume accesses immediately below %esp are due to gcc-2.96 bugs.
  * default: NO */
 extern Bool MC_(clo_workaround_gcc296_bugs);
@@ -739,6 +747,10 @@ extern KeepStacktraces MC_(clo_keep_stacktraces);
 */
 extern Int MC_(clo_mc_level);
 
+/* Size in megabytes of the first level origin tracking cache.
+   Default: 96 */
+extern Int MC_(clo_origin_cache_size);
+
 /* Should we show mismatched frees?  Default: YES */
 extern Bool MC_(clo_show_mismatched_frees);
 
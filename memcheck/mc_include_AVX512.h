@@ -38,6 +38,8 @@ enum {
    MCPE_LOADV_512_SLOW_LOOP,
    MCPE_LOADV_512_SLOW1,
    MCPE_LOADV_512_SLOW2,
+   MCPE_STOREV512_DEFINED,
+   MCPE_STOREV512_DEFINED_SLOW,
    MCPE_LAST
 };
 #endif
@@ -47,6 +49,7 @@ VG_REGPARM(1) UWord MC_(helperc_b_load64)( Addr a );
 
 /* V-bits load/store helpers */
 VG_REGPARM(2) void  MC_(helperc_LOADV512) ( /*OUT*/V512*, Addr );
+VG_REGPARM(1) void  MC_(helperc_STOREV512le_defined) ( Addr );
 
 #endif /* ndef __MC_INCLUDE_512_H */
 #endif /* ndef AVX_512 */
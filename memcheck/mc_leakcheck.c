@@ -482,6 +482,20 @@ static SizeT lc_chunks_n_frees_marker;
 // lc_extras[i] describe the same block).
 static LC_Extra* lc_extras;
 
+// An index speeding up the search of the chunk a word points into.
+// No chunk is outside [lc_chunks_min, lc_chunks_max[, so any word
+// outside this range is rejected at once.  If the chunks do not overlap,
+// this range is also divided into buckets of 2^lc_index_shift bytes, and
+// lc_index[b] is the index of the first chunk ending after the start of
+// bucket b.  A chunk containing an address in bucket b then has an index
+// in [lc_index[b], lc_index[b+1]], so that the binary search is limited
+// to these few chunks instead of all of lc_chunks.  Built together with
+// lc_chunks.
+static Addr lc_chunks_min = 0;
+static Addr lc_chunks_max = 0;
+static Int* lc_index = NULL;
+static UInt lc_index_shift;
+
 // chunks will be converted and merged in loss record, maintained in lr_table
 // lr_table elements are kept from one leak_search to another to implement
 // the "print new/changed leaks" client request
@@ -519,6 +533,67 @@ static SizeT lc_scanned_szB;
 // caused a signal such as SIGSEGV.
 static SizeT lc_sig_skipped_szB;
 
+// Incremental root scanning (--incremental-leak-check=yes).
+//
+// We cannot tell which memory was written since the previous leak search
+// from the shadow memory: a store of a defined value to defined memory
+// does not change it.  Instead, the root scan remembers for each root
+// region (the part of a root segment within one secondary map) a
+// fingerprint of its valid words, and the words in it which point into
+// client memory.  At the next search, if the client segments are the
+// same and the fingerprint of a region has not changed, the remembered
+// words are pushed again instead of scanning the region.  The chunks they
+// point to are looked up again, so the results are exactly the same as
+// with a full scan; only the lookups of words pointing nowhere are saved.
+typedef
+   struct {
+      Addr  start;
+      SizeT len;
+      ULong fingerprint;
+      UInt  n_valid;     // Nr of valid words in the region.
+      UInt  first_cand;  // Index of its first word in lc_root_cands.
+      UInt  n_cands;
+   }
+   LC_RootRegion;
+
+// The regions and words remembered by the previous root scan, in
+// increasing address order.
+static XArray* lc_root_regions = NULL;   // of LC_RootRegion
+static XArray* lc_root_cands = NULL;     // of Addr
+static ULong   lc_root_segs_fingerprint = 0;
+
+// Regions with more words pointing into client memory than this are
+// not remembered, to bound the memory used.
+#define LC_MAX_REGION_CANDS (SM_SIZE / sizeof(Addr) / 8)
+
+// What lc_scan_memory is doing for the root region being scanned.
+typedef
+   enum {
+      LcRegionNone,        // Nothing special.
+      LcRegionRecord,      // Normal scan, also computing the fingerprint
+                           // and appending the candidates to lc_new_cands.
+      LcRegionFingerprint  // Only compute the fingerprint.
+   }
+   LC_RegionMode;
+
+static LC_RegionMode lc_region_mode = LcRegionNone;
+static ULong         lc_region_fingerprint;
+static UInt          lc_region_n_valid;
+static XArray*       lc_new_cands;       // of Addr
+// The regions remembered by the current root scan.
+static XArray*       lc_root_regions_new;   // of LC_RootRegion
+
+// Nr of root regions reused and scanned by the last leak search.
+static UInt lc_n_regions_reused;
+static UInt lc_n_regions_scanned;
+
+static inline ULong lc_fingerprint_mix ( ULong fp, ULong w )
+{
+   fp ^= w;
+   fp *= 0x9E3779B97F4A7C15ULL;
+   return fp ^ (fp >> 29);
+}
+
 
 SizeT MC_(bytes_leaked)     = 0;
 SizeT MC_(bytes_indirect)   = 0;
@@ -539,6 +614,85 @@ static SizeT MC_(bytes_heuristically_reachable)[N_LEAK_CHECK_HEURISTICS]
 static SizeT MC_(blocks_heuristically_reachable)[N_LEAK_CHECK_HEURISTICS]
                                                 = {0,0,0,0};
 
+// End of a chunk, for the purpose of finding the chunk a pointer points
+// into.  See find_chunk_for about zero-sized blocks.
+static inline Addr lc_chunk_end(const MC_Chunk* ch)
+{
+   return ch->data + ch->szB + (ch->szB == 0 ? 1 : 0);
+}
+
+static void lc_free_chunk_index(void)
+{
+   if (lc_index) {
+      VG_(free)(lc_index);
+      lc_index = NULL;
+   }
+   lc_chunks_min = 0;
+   lc_chunks_max = 0;
+}
+
+// Build the index over lc_chunks.
+static void lc_build_chunk_index(void)
+{
+   Int   i;
+   Bool  overlap = False;
+   SizeT n_buckets, b;
+
+   lc_free_chunk_index();
+   if (lc_n_chunks == 0)
+      return;
+
+   lc_chunks_min = lc_chunks[0]->data;
+   for (i = 0; i < lc_n_chunks; i++) {
+      if (lc_chunk_end(lc_chunks[i]) > lc_chunks_max)
+         lc_chunks_max = lc_chunk_end(lc_chunks[i]);
+      if (i > 0 && lc_chunks[i]->data < lc_chunk_end(lc_chunks[i-1]))
+         overlap = True;
+   }
+   // With overlapping blocks (metapools), the binary search limited to
+   // a bucket might find a different block than the full one.
+   if (overlap)
+      return;
+
+   // About one bucket per chunk, as the chunks do not overlap.
+   lc_index_shift = 4;
+   while (((lc_chunks_max - lc_chunks_min) >> lc_index_shift)
+          >= (SizeT)lc_n_chunks)
+      lc_index_shift++;
+   n_buckets = ((lc_chunks_max - lc_chunks_min) >> lc_index_shift) + 1;
+
+   lc_index = VG_(malloc)("mc.lbci.1", (n_buckets + 1) * sizeof(Int));
+   i = 0;
+   for (b = 0; b <= n_buckets; b++) {
+      Addr bucket_start = lc_chunks_min + (b << lc_index_shift);
+      while (i < lc_n_chunks && lc_chunk_end(lc_chunks[i]) <= bucket_start)
+         i++;
+      lc_index[b] = i;
+   }
+}
+
+// Same as find_chunk_for(ptr, lc_chunks, lc_n_chunks), using the index.
+static Int lc_find_chunk(Addr ptr)
+{
+   UWord b;
+   Int   lo, hi, ch_no;
+
+   if (ptr < lc_chunks_min || ptr >= lc_chunks_max)
+      return -1;
+   if (lc_index == NULL)
+      return find_chunk_for(ptr, lc_chunks, lc_n_chunks);
+
+   b = (ptr - lc_chunks_min) >> lc_index_shift;
+   lo = lc_index[b];
+   hi = lc_index[b+1];
+   if (hi >= lc_n_chunks)
+      hi = lc_n_chunks - 1;
+   if (lo > hi)
+      return -1;
+   ch_no = find_chunk_for(ptr, &lc_chunks[lo], hi - lo + 1);
+   return ch_no == -1 ? -1 : lo + ch_no;
+}
+
 // Determines if a pointer is to a chunk.  Returns the chunk number et al
 // via call-by-reference.
 static Bool
@@ -548,14 +702,16 @@ lc_is_a_chunk_ptr(Addr ptr, Int* pch_no, MC_Chunk** pch, LC_Extra** pex)
    MC_Chunk* ch;
    LC_Extra* ex;
 
-   // Quick filter. Note: implemented with am, not with get_vabits2
-   // as ptr might be random data pointing anywhere. On 64 bit
-   // platforms, getting va bits for random data can be quite costly
-   // due to the secondary map.
-   if (!VG_(am_is_valid_for_client)(ptr, 1, VKI_PROT_READ)) {
+   // Quick filters.  First, anything outside of the heap.  Then, with am,
+   // not with get_vabits2 as ptr might be random data pointing anywhere.
+   // On 64 bit platforms, getting va bits for random data can be quite
+   // costly due to the secondary map.
+   if (ptr < lc_chunks_min || ptr >= lc_chunks_max) {
+      return False;
+   } else if (!VG_(am_is_valid_for_client)(ptr, 1, VKI_PROT_READ)) {
       return False;
    } else {
-      ch_no = find_chunk_for(ptr, lc_chunks, lc_n_chunks);
+      ch_no = lc_find_chunk(ptr);
       tl_assert(ch_no >= -1 && ch_no < lc_n_chunks);
 
       if (ch_no == -1) {
@@ -1077,6 +1233,11 @@ lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
    Addr ptr = VG_ROUNDUP(start, sizeof(Addr));
    const Addr end = VG_ROUNDDN(start+len, sizeof(Addr));
    fault_catcher_t prev_catcher;
+   /* Validity of the group of MC_VALID_WORDS_GROUP words starting at
+      valid_base, so as to avoid a shadow memory lookup per word. */
+   const Addr group_szB = MC_VALID_WORDS_GROUP * sizeof(Addr);
+   Addr  valid_base;
+   UWord valid_mask;
 
    if (VG_DEBUG_LEAKCHECK)
       VG_(printf)("scan %#lx-%#lx (%lu)\n", start, end, len);
@@ -1131,6 +1292,11 @@ lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
       ptr = bad_scanned_addr + sizeof(Addr); // Unaddressable, - skip it.
 #endif
    }
+   // Set up here, as values assigned after the setjmp are lost by a
+   // longjmp.  1 is never group aligned, so the first word fetches
+   // the mask.
+   valid_base = 1;
+   valid_mask = 0;
    while (ptr < end) {
       Addr addr;
 
@@ -1150,10 +1316,34 @@ lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
          }
       }
 
-      if ( MC_(is_valid_aligned_word)(ptr) ) {
+      if (UNLIKELY(VG_ROUNDDN(ptr, group_szB) != valid_base)) {
+         valid_base = VG_ROUNDDN(ptr, group_szB);
+         valid_mask = MC_(valid_aligned_words_mask)(valid_base);
+      }
+
+      if ( valid_mask & ((UWord)1 << ((ptr - valid_base) / sizeof(Addr))) ) {
+         if (UNLIKELY(lc_region_mode == LcRegionFingerprint)) {
+            addr = *(Addr *)ptr;
+            lc_region_fingerprint
+               = lc_fingerprint_mix(lc_region_fingerprint, ptr);
+            lc_region_fingerprint
+               = lc_fingerprint_mix(lc_region_fingerprint, addr);
+            lc_region_n_valid++;
+            ptr += sizeof(Addr);
+            continue;
+         }
          lc_scanned_szB += sizeof(Addr);
          // If the below read fails, we will longjmp to the loop begin.
          addr = *(Addr *)ptr;
+         if (UNLIKELY(lc_region_mode == LcRegionRecord)) {
+            lc_region_fingerprint
+               = lc_fingerprint_mix(lc_region_fingerprint, ptr);
+            lc_region_fingerprint
+               = lc_fingerprint_mix(lc_region_fingerprint, addr);
+            lc_region_n_valid++;
+            if (VG_(am_is_valid_for_client)(addr, 1, VKI_PROT_READ))
+               VG_(addToXA)(lc_new_cands, &addr);
+         }
          // If we get here, the scanned word is in valid memory.  Now
          // let's see if its contents point to a chunk.
          if (UNLIKELY(searched)) {
@@ -1941,18 +2131,133 @@ Bool MC_(print_block_list) ( UInt loss_record_nr_from,
 // encountered.
 // Otherwise (searched != 0), scan the memory root set searching for ptr
 // pointing inside [searched, searched+szB[.
+// A fingerprint of the client segments, as these determine which
+// words point into client memory.
+static ULong lc_client_segments_fingerprint(void)
+{
+   Int   i;
+   Int   n_seg_starts;
+   Addr* seg_starts = VG_(get_segment_starts)( SkFileC | SkAnonC | SkShmC,
+                                               &n_seg_starts );
+   ULong fp = 0;
+
+   for (i = 0; i < n_seg_starts; i++) {
+      NSegment const* seg = VG_(am_find_nsegment)( seg_starts[i] );
+      tl_assert(seg);
+      fp = lc_fingerprint_mix(fp, seg->start);
+      fp = lc_fingerprint_mix(fp, seg->end);
+      fp = lc_fingerprint_mix(fp, seg->kind
+                                  | (seg->hasR << 8) | (seg->hasW << 9)
+                                  | (seg->hasX << 10) | (seg->isCH << 11));
+   }
+   VG_(free)(seg_starts);
+   return fp;
+}
+
+// Scan the root region [start, start+len[, or reuse the result of its
+// scan by the previous leak search, if it has not changed.  *old_ix is
+// the index in lc_root_regions from which to look for the region.
+static void lc_scan_root_region(Addr start, SizeT len, Word* old_ix)
+{
+   const Word n_old = lc_root_regions ? VG_(sizeXA)(lc_root_regions) : 0;
+   LC_RootRegion* old = NULL;
+   LC_RootRegion  new;
+   SizeT          skipped = lc_sig_skipped_szB;
+   UInt           i;
+
+   while (*old_ix < n_old) {
+      LC_RootRegion* r = VG_(indexXA)(lc_root_regions, *old_ix);
+      if (r->start >= start) {
+         if (r->start == start && r->len == len)
+            old = r;
+         break;
+      }
+      (*old_ix)++;
+   }
+
+   if (old != NULL) {
+      lc_region_mode = LcRegionFingerprint;
+      lc_region_fingerprint = 0;
+      lc_region_n_valid = 0;
+      lc_scan_memory(start, len, /*is_prior_definite*/True,
+                     /*clique*/-1, /*cur_clique*/-1, /*searched*/0, 0);
+      lc_region_mode = LcRegionNone;
+      if (lc_sig_skipped_szB == skipped
+          && lc_region_fingerprint == old->fingerprint
+          && lc_region_n_valid == old->n_valid) {
+         // Unchanged: push the words found last time.
+         new = *old;
+         new.first_cand = VG_(sizeXA)(lc_new_cands);
+         for (i = 0; i < old->n_cands; i++) {
+            Addr addr = *(Addr*)VG_(indexXA)(lc_root_cands,
+                                             old->first_cand + i);
+            VG_(addToXA)(lc_new_cands, &addr);
+            lc_push_if_a_chunk_ptr(addr, /*clique*/-1, /*cur_clique*/-1,
+                                   /*is_prior_definite*/True);
+         }
+         VG_(addToXA)(lc_root_regions_new, &new);
+         lc_scanned_szB += new.n_valid * sizeof(Addr);
+         lc_n_regions_reused++;
+         return;
+      }
+      // Changed, or a read error.  The full scan below will count the
+      // skipped bytes again.
+      lc_sig_skipped_szB = skipped;
+   }
+
+   new.start = start;
+   new.len = len;
+   new.first_cand = VG_(sizeXA)(lc_new_cands);
+   lc_region_mode = LcRegionRecord;
+   lc_region_fingerprint = 0;
+   lc_region_n_valid = 0;
+   lc_scan_memory(start, len, /*is_prior_definite*/True,
+                  /*clique*/-1, /*cur_clique*/-1, /*searched*/0, 0);
+   lc_region_mode = LcRegionNone;
+   new.fingerprint = lc_region_fingerprint;
+   new.n_valid = lc_region_n_valid;
+   new.n_cands = VG_(sizeXA)(lc_new_cands) - new.first_cand;
+   lc_n_regions_scanned++;
+   if (lc_sig_skipped_szB == skipped && new.n_cands <= LC_MAX_REGION_CANDS)
+      VG_(addToXA)(lc_root_regions_new, &new);
+   else
+      VG_(dropTailXA)(lc_new_cands, new.n_cands);
+}
+
 static void scan_memory_root_set(Addr searched, SizeT szB)
 {
    Int   i;
    Int   n_seg_starts;
    Addr* seg_starts = VG_(get_segment_starts)( SkFileC | SkAnonC | SkShmC,
                                                &n_seg_starts );
+   const Bool incremental = MC_(clo_incremental_leak_check) && searched == 0;
+   Word  old_ix = 0;
 
    tl_assert(seg_starts && n_seg_starts > 0);
 
    lc_scanned_szB = 0;
    lc_sig_skipped_szB = 0;
 
+   if (incremental) {
+      ULong segs_fingerprint = lc_client_segments_fingerprint();
+      if (lc_root_regions != NULL
+          && segs_fingerprint != lc_root_segs_fingerprint) {
+         // Words may now point into client memory, or not, differently
+         // from last time, so forget everything.
+         VG_(deleteXA)(lc_root_regions);
+         VG_(deleteXA)(lc_root_cands);
+         lc_root_regions = NULL;
+         lc_root_cands = NULL;
+      }
+      lc_root_segs_fingerprint = segs_fingerprint;
+      lc_root_regions_new = VG_(newXA)(VG_(malloc), "mc.smrs.1", VG_(free),
+                                       sizeof(LC_RootRegion));
+      lc_new_cands = VG_(newXA)(VG_(malloc), "mc.smrs.2", VG_(free),
+                                sizeof(Addr));
+      lc_n_regions_reused = 0;
+      lc_n_regions_scanned = 0;
+   }
+
    // VG_(am_show_nsegments)( 0, "leakcheck");
    for (i = 0; i < n_seg_starts; i++) {
       SizeT seg_size;
@@ -1989,11 +2294,35 @@ static void scan_memory_root_set(Addr searched, SizeT szB)
                       "  Scanning root segment: %#lx..%#lx (%lu)\n",
                       seg->start, seg->end, seg_size);
       }
-      lc_scan_memory(seg->start, seg_size, /*is_prior_definite*/True,
-                     /*clique*/-1, /*cur_clique*/-1,
-                     searched, szB);
+      if (incremental) {
+         Addr a = seg->start;
+         while (a <= seg->end) {
+            Addr r_end = VG_ROUNDDN(a, SM_SIZE) + SM_SIZE - 1;
+            if (r_end > seg->end)
+               r_end = seg->end;
+            lc_scan_root_region(a, r_end - a + 1, &old_ix);
+            if (r_end == seg->end)
+               break;
+            a = r_end + 1;
+         }
+      } else {
+         lc_scan_memory(seg->start, seg_size, /*is_prior_definite*/True,
+                        /*clique*/-1, /*cur_clique*/-1,
+                        searched, szB);
+      }
    }
    VG_(free)(seg_starts);
+
+   if (incremental) {
+      if (lc_root_regions != NULL) {
+         VG_(deleteXA)(lc_root_regions);
+         VG_(deleteXA)(lc_root_cands);
+      }
+      lc_root_regions = lc_root_regions_new;
+      lc_root_cands = lc_new_cands;
+      lc_root_regions_new = NULL;
+      lc_new_cands = NULL;
+   }
 }
 
 static MC_Mempool *find_mp_of_chunk (MC_Chunk* mc_search)
@@ -2043,6 +2372,7 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
       VG_(free)(lc_chunks);
       lc_chunks = NULL;
    }
+   lc_free_chunk_index();
    lc_chunks = get_sorted_array_of_active_chunks(&lc_n_chunks);
    lc_chunks_n_frees_marker = MC_(get_cmalloc_n_frees)();
    if (lc_n_chunks == 0) {
@@ -2162,6 +2492,8 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
       }
    }
 
+   lc_build_chunk_index();
+
    // Initialise lc_extras.
    if (lc_extras) {
       VG_(free)(lc_extras);
@@ -2204,6 +2536,10 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
       if (lc_sig_skipped_szB > 0)
          VG_(umsg)("Skipped %'lu bytes due to read errors\n",
                    lc_sig_skipped_szB);
+      if (MC_(clo_incremental_leak_check))
+         VG_(umsg)("Reused the scan of %'u of %'u root regions\n",
+                   lc_n_regions_reused,
+                   lc_n_regions_reused + lc_n_regions_scanned);
       VG_(umsg)( "\n" );
    }
 
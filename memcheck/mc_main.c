@@ -45,6 +45,7 @@
 #include "pub_tool_replacemalloc.h"
 #include "pub_tool_tooliface.h"
 #include "pub_tool_threadstate.h"
+#include "pub_tool_vki.h"            // VKI_PROT_*
 #include "pub_tool_xarray.h"
 #include "pub_tool_xtree.h"
 #include "pub_tool_xtmemory.h"
@@ -299,6 +300,65 @@ static INLINE Bool is_distinguished_sm ( SecMap* sm ) {
 // Forward declaration
 static void update_SM_counts(SecMap* oldSM, SecMap* newSM);
 
+/* Non-distinguished secondaries are obtained from aspacem
+   SM_ALLOC_BATCH at a time, and ones that are no longer needed are put
+   on a free list for reuse, rather than being unmapped.  Doing an mmap
+   and later an munmap for each 16k SecMap is expensive when large
+   address ranges change state, eg. when big blocks are allocated and
+   freed repeatedly.  Memory on the free list is not given back to the
+   OS, but it was in use as SecMaps at the high-water mark anyway. */
+#define SM_ALLOC_BATCH 64    /* 64 SecMaps of 16k, so 1MB per batch */
+
+typedef
+   struct _FreeSecMap {
+      struct _FreeSecMap* next;
+   }
+   FreeSecMap;
+
+static FreeSecMap* sm_free_list  = NULL;
+static SecMap*     sm_batch_next = NULL; /* unused part of current batch */
+static UInt        sm_batch_left = 0;
+
+static SecMap* alloc_secmap ( void )
+{
+   SecMap* sm;
+
+   if (sm_free_list != NULL) {
+      sm = (SecMap*)sm_free_list;
+      sm_free_list = sm_free_list->next;
+      return sm;
+   }
+
+   if (sm_batch_left == 0) {
+      SysRes sres = VG_(am_shadow_alloc)(SM_ALLOC_BATCH * sizeof(SecMap));
+      if (!sr_isError(sres)) {
+         sm_batch_next = (SecMap*)(Addr)sr_Res(sres);
+         sm_batch_left = SM_ALLOC_BATCH;
+      } else {
+         /* Address space is getting tight.  Fall back to getting just
+            the one we need. */
+         sres = VG_(am_shadow_alloc)(sizeof(SecMap));
+         if (sr_isError(sres))
+            VG_(out_of_memory_NORETURN)( "memcheck:allocate new SecMap",
+                                         sizeof(SecMap), sr_Err(sres) );
+         return (SecMap*)(Addr)sr_Res(sres);
+      }
+   }
+
+   sm = sm_batch_next;
+   sm_batch_next++;
+   sm_batch_left--;
+   return sm;
+}
+
+static void free_secmap ( SecMap* sm )
+{
+   tl_assert(!is_distinguished_sm(sm));
+   FreeSecMap* fsm = (FreeSecMap*)sm;
+   fsm->next = sm_free_list;
+   sm_free_list = fsm;
+}
+
 /* dist_sm points to one of our three distinguished secondaries.  Make
    a copy of it so that we can write to it.
 */
@@ -309,11 +369,7 @@ static SecMap* copy_for_writing ( SecMap* dist_sm )
           || dist_sm == &sm_distinguished[1]
           || dist_sm == &sm_distinguished[2]);
 
-   SysRes sres = VG_(am_shadow_alloc)(sizeof(SecMap));
-   if (sr_isError(sres))
-      VG_(out_of_memory_NORETURN)( "memcheck:allocate new SecMap",
-                                   sizeof(SecMap), sr_Err(sres) );
-   new_sm = (void *)(Addr)sr_Res(sres);
+   new_sm = alloc_secmap();
    VG_(memcpy)(new_sm, dist_sm, sizeof(SecMap));
    update_SM_counts(dist_sm, new_sm);
    return new_sm;
@@ -1841,8 +1897,7 @@ static void set_address_range_perms ( Addr a, SizeT lenT, UWord vabits16,
          PROF_EVENT(MCPE_SET_ADDRESS_RANGE_PERMS_LOOP64K_FREE_DIST_SM);
          // Free the non-distinguished sec-map that we're replacing.  This
          // case happens moderately often, enough to be worthwhile.
-         SysRes sres = VG_(am_munmap_valgrind)((Addr)*sm_ptr, sizeof(SecMap));
-         tl_assert2(! sr_isError(sres), "SecMap valgrind munmap failure\n");
+         free_secmap(*sm_ptr);
       }
       update_SM_counts(*sm_ptr, example_dsm);
       // Make the sec-map entry point to the example DSM
@@ -2006,10 +2061,75 @@ static void make_mem_defined_if_noaccess ( Addr a, SizeT len )
 /* --- Block-copy permissions (needed for implementing realloc() and
        sys_mremap). --- */
 
+/* Copy the state of the n bytes at src to dst, where src and dst are
+   4-aligned, n is a multiple of 4, and each range lies within one
+   secondary map.  The ranges may overlap. */
+static void copy_address_range_state_run ( Addr src, Addr dst, SizeT n )
+{
+   SizeT    k;
+   UChar    vabits2, vabits8;
+   SecMap*  sm_src = get_secmap_for_reading( src );
+   SecMap*  sm_dst;
+   SecMap** sm_dst_ptr;
+   UWord    off_src = SM_OFF(src);
+   UWord    off_dst = SM_OFF(dst);
+
+   if (is_distinguished_sm(sm_src)) {
+      sm_dst_ptr = get_secmap_ptr( dst );
+      if (*sm_dst_ptr == sm_src) {
+         /* Nothing to change. */
+      } else if (n == SM_SIZE) {
+         /* A whole secondary map: share the distinguished one, as
+            set_address_range_perms does. */
+         if (!is_distinguished_sm(*sm_dst_ptr))
+            free_secmap(*sm_dst_ptr);
+         update_SM_counts(*sm_dst_ptr, sm_src);
+         *sm_dst_ptr = sm_src;
+      } else {
+         sm_dst = get_secmap_for_writing( dst );
+         VG_(memset)( &sm_dst->vabits8[off_dst], sm_src->vabits8[0], n / 4 );
+      }
+      return;
+   }
+
+   for (k = 0; k < n / 4; k++) {
+      vabits8 = sm_src->vabits8[off_src + k];
+      if (UNLIKELY(VA_BITS8_DEFINED != vabits8
+                   && VA_BITS8_UNDEFINED != vabits8
+                   && VA_BITS8_NOACCESS != vabits8))
+         break;
+   }
+   if (LIKELY(k == n / 4)) {
+      /* No partially defined bytes: only the vabits8 to copy. */
+      sm_dst = get_secmap_for_writing( dst );
+      VG_(memmove)( &sm_dst->vabits8[off_dst],
+                    &sm_src->vabits8[off_src], n / 4 );
+      return;
+   }
+
+   /* Have to copy secondary map info too.  Do it a byte at a time, in
+      the direction that works for overlapping ranges. */
+   if (src < dst) {
+      for (k = n; k > 0; k--) {
+         vabits2 = get_vabits2( src+k-1 );
+         set_vabits2( dst+k-1, vabits2 );
+         if (VA_BITS2_PARTDEFINED == vabits2)
+            set_sec_vbits8( dst+k-1, get_sec_vbits8( src+k-1 ) );
+      }
+   } else {
+      for (k = 0; k < n; k++) {
+         vabits2 = get_vabits2( src+k );
+         set_vabits2( dst+k, vabits2 );
+         if (VA_BITS2_PARTDEFINED == vabits2)
+            set_sec_vbits8( dst+k, get_sec_vbits8( src+k ) );
+      }
+   }
+}
+
 void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
 {
-   SizeT i, j;
-   UChar vabits2, vabits8;
+   SizeT i, j, n;
+   UChar vabits2;
    Bool  aligned, nooverlap;
 
    DEBUG("MC_(copy_address_range_state)\n");
@@ -2021,31 +2141,22 @@ void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
    aligned   = VG_IS_4_ALIGNED(src) && VG_IS_4_ALIGNED(dst);
    nooverlap = src+len <= dst || dst+len <= src;
 
-   if (nooverlap && aligned) {
+   if (aligned && (nooverlap || src > dst)) {
 
-      /* Vectorised fast case, when no overlap and suitably aligned */
-      /* vector loop */
+      /* Vectorised fast case, when suitably aligned, copying forwards.
+         Both ranges are cut into runs lying within one secondary map of
+         src and one of dst, and the vabits8 of each run are copied at
+         once. */
       i = 0;
       while (len >= 4) {
-         vabits8 = get_vabits8_for_aligned_word32( src+i );
-         set_vabits8_for_aligned_word32( dst+i, vabits8 );
-         if (LIKELY(VA_BITS8_DEFINED == vabits8
-                            || VA_BITS8_UNDEFINED == vabits8
-                            || VA_BITS8_NOACCESS == vabits8)) {
-            /* do nothing */
-         } else {
-            /* have to copy secondary map info */
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+0 ))
-               set_sec_vbits8( dst+i+0, get_sec_vbits8( src+i+0 ) );
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+1 ))
-               set_sec_vbits8( dst+i+1, get_sec_vbits8( src+i+1 ) );
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+2 ))
-               set_sec_vbits8( dst+i+2, get_sec_vbits8( src+i+2 ) );
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+3 ))
-               set_sec_vbits8( dst+i+3, get_sec_vbits8( src+i+3 ) );
-         }
-         i += 4;
-         len -= 4;
+         n = len & ~(SizeT)3;
+         if (n > SM_SIZE - ((src+i) & SM_MASK))
+            n = SM_SIZE - ((src+i) & SM_MASK);
+         if (n > SM_SIZE - ((dst+i) & SM_MASK))
+            n = SM_SIZE - ((dst+i) & SM_MASK);
+         copy_address_range_state_run( src+i, dst+i, n );
+         i += n;
+         len -= n;
       }
       /* fixup loop */
       while (len >= 1) {
@@ -2058,6 +2169,28 @@ void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
          len--;
       }
 
+   } else if (aligned) {
+
+      /* The same, copying backwards as src < dst and they overlap. */
+      /* fixup loop, for the bytes after the last whole word32 */
+      while ((len & 3) != 0) {
+         len--;
+         vabits2 = get_vabits2( src+len );
+         set_vabits2( dst+len, vabits2 );
+         if (VA_BITS2_PARTDEFINED == vabits2) {
+            set_sec_vbits8( dst+len, get_sec_vbits8( src+len ) );
+         }
+      }
+      while (len >= 4) {
+         n = len;
+         if (n > ((src+len-1) & SM_MASK) + 1)
+            n = ((src+len-1) & SM_MASK) + 1;
+         if (n > ((dst+len-1) & SM_MASK) + 1)
+            n = ((dst+len-1) & SM_MASK) + 1;
+         copy_address_range_state_run( src+len-n, dst+len-n, n );
+         len -= n;
+      }
+
    } else {
 
       /* We have to do things the slow way */
@@ -2163,8 +2296,9 @@ void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
 
    Memory is shadowed using a two level cache structure (ocacheL1 and
    ocacheL2).  Memory references are first directed to ocacheL1.  This
-   is a traditional 2-way set associative cache with 32-byte lines and
-   approximate LRU replacement within each set.
+   is a traditional 4-way set associative cache with 32-byte lines and
+   approximate LRU replacement within each set.  Its size can be set
+   with --origin-cache-size.
 
    A naive implementation would require storing one 32 bit otag for
    each byte of memory covered, a 4:1 space overhead.  Instead, there
@@ -2183,7 +2317,9 @@ void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
    nonzeroes risks losing origin information permanently.  In order to
    prevent such lossage, ejected nonzero lines are placed in a
    secondary cache (ocacheL2), which is an OSet (AVL tree) of cache
-   lines.  This can grow arbitrarily large, and so should ensure that
+   lines.  Lines in which all bytes that have an origin have the same
+   origin are stored there in compressed form.  The L2 can grow
+   arbitrarily large, and so should ensure that
    Memcheck runs out of memory in preference to losing useful origin
    info due to cache size limitations.
 
@@ -2412,6 +2548,7 @@ static UWord stats__ocacheL2_adds          = 0;
 static UWord stats__ocacheL2_dels          = 0;
 static UWord stats__ocacheL2_misses        = 0;
 static UWord stats__ocacheL2_n_nodes_max   = 0;
+static UWord stats__ocacheL2_adds_compr    = 0;
 
 /* Cache of 32-bit values, one every 32 bits of address space */
 
@@ -2425,15 +2562,15 @@ static INLINE Bool is_valid_oc_tag ( Addr tag ) {
    return 0 == (tag & ((1 << OC_BITS_PER_LINE) - 1));
 }
 
-#define OC_LINES_PER_SET 2
+#define OC_LINES_PER_SET 4
 
-#define OC_N_SET_BITS    20
-#define OC_N_SETS        (1 << OC_N_SET_BITS)
-
-/* These settings give:
-   64 bit host: ocache:  100,663,296 sizeB    67,108,864 useful
-   32 bit host: ocache:   92,274,688 sizeB    67,108,864 useful
+/* The number of sets is the largest power of two for which ocacheL1 fits
+   in --origin-cache-size megabytes.  The default of 96 gives, on both
+   32 and 64 bit hosts:
+   ocache:  100,663,296 sizeB    67,108,864 useful
 */
+static UWord ocacheL1_n_sets   = 0;
+static UWord ocacheL1_set_mask = 0;
 
 #define OC_MOVE_FORWARDS_EVERY_BITS 7
 
@@ -2446,114 +2583,121 @@ static INLINE Bool is_valid_oc_tag ( Addr tag ) {
    size is 32 bytes).  Changing that would require a bunch of re-tuning
    effort.  So let's set it in stone for now. */
 STATIC_ASSERT(OC_BITS_PER_LINE == 5);
-STATIC_ASSERT(OC_LINES_PER_SET == 2);
+STATIC_ASSERT(OC_LINES_PER_SET == 4);
 
-/* Fundamentally we want an OCacheLine structure (see below) as follows:
+/* Fundamentally we want an OCacheLine structure as follows:
       struct {
          Addr tag;
          UInt  w32  [OC_W32S_PER_LINE];
          UChar descr[OC_W32S_PER_LINE];
       }
-   However, in various places, we want to set the w32[] and descr[] arrays to
-   zero, or check if they are zero.  This can be a very hot path (per bug
-   446103).  So, instead, we have a union which is either those two arrays
-   (OCacheLine_Main) or simply an array of ULongs (OCacheLine_W64s).  For the
-   set-zero/test-zero operations, the OCacheLine_W64s are used.
+   However, the lines of a set are not stored like that, but as separate
+   arrays of tags, descrs and w32s, see OCacheSet below.  find_OCacheLine
+   therefore returns an OCacheLine, which points at the descr[] and w32[]
+   arrays of the line.
+
+   In various places, we want to set the descr[] array to zero, or check if
+   it is zero.  This can be a very hot path (per bug 446103).  So descr[] is
+   in a union with a ULong, which is used for the set-zero/test-zero
+   operations.
 */
 
 // To ensure that OCacheLine.descr[] will fit in an integral number of ULongs.
 STATIC_ASSERT(0 == (OC_W32S_PER_LINE % 8));
 
-#define OC_W64S_PER_MAIN /* "MAIN" meaning "struct OCacheLine_Main" */   \
-           (OC_W32S_PER_LINE / 2    /* covers OCacheLine_Main.w32[] */   \
-            + OC_W32S_PER_LINE / 8) /* covers OCacheLine_Main.descr[] */
-STATIC_ASSERT(OC_W64S_PER_MAIN == 5);
-
 typedef
-   ULong OCacheLine_W64s[OC_W64S_PER_MAIN];
-
-typedef
-   struct {
-      UInt  w32  [OC_W32S_PER_LINE];
+   union {
+      ULong w64;
       UChar descr[OC_W32S_PER_LINE];
    }
-   OCacheLine_Main;
+   OCacheDescrs;
 
-STATIC_ASSERT(sizeof(OCacheLine_W64s) == sizeof(OCacheLine_Main));
+STATIC_ASSERT(sizeof(OCacheDescrs) == sizeof(ULong));
 
 typedef
    struct {
-      Addr  tag;
-      union {
-         OCacheLine_W64s w64s;
-         OCacheLine_Main main;
-      } u;
+      UChar* descr;
+      UInt*  w32;
    }
    OCacheLine;
 
-/* Classify and also sanity-check 'line'.  Return 'e' (empty) if not
-   in use, 'n' (nonzero) if it contains at least one valid origin tag,
-   and 'z' if all the represented tags are zero. */
-static inline UChar classify_OCacheLine ( OCacheLine* line )
+/* A set of ocacheL1.  The tags and the descrs of all lines of the set are
+   in the first 64 bytes, and the w32s of the lines after that.  Since
+   ocacheL1 is page aligned and sets are a multiple of 64 bytes, finding a
+   line in a set and looking at or updating its descrs touches a single
+   host cache line, whichever line of the set it is.  Only accesses that
+   read or write an origin also touch the w32s of the line, which never
+   straddle two host cache lines.  On 32 bit hosts the tags take half the
+   space, and are padded such that the layout is the same. */
+typedef
+   struct {
+      Addr         tag[OC_LINES_PER_SET];
+#     if VG_WORDSIZE == 4
+      UInt         pad[OC_LINES_PER_SET];
+#     endif
+      OCacheDescrs d[OC_LINES_PER_SET];
+      UInt         w32[OC_LINES_PER_SET][OC_W32S_PER_LINE];
+   }
+   OCacheSet;
+
+STATIC_ASSERT(sizeof(OCacheSet) == 192);
+
+static inline OCacheLine oc_set_line ( OCacheSet* set, UWord lineno )
+{
+   OCacheLine line = { set->d[lineno].descr, set->w32[lineno] };
+   return line;
+}
+
+/* Classify and also sanity-check line 'lineno' of 'set'.  Return 'e'
+   (empty) if not in use, 'n' (nonzero) if it contains at least one valid
+   origin tag, and 'z' if all the represented tags are zero. */
+static inline UChar classify_OCacheLine ( const OCacheSet* set, UWord lineno )
 {
    UWord i;
-   if (line->tag == 1/*invalid*/)
+   if (set->tag[lineno] == 1/*invalid*/)
       return 'e'; /* EMPTY */
-   tl_assert(is_valid_oc_tag(line->tag));
+   tl_assert(is_valid_oc_tag(set->tag[lineno]));
 
-   // BEGIN fast special-case of the test loop below.  This will detect
-   // zero-ness (case 'z') for a subset of cases that the loop below will,
-   // hence is safe.
-   if (OC_W64S_PER_MAIN == 5) {
-      if (line->u.w64s[0] == 0
-          && line->u.w64s[1] == 0 && line->u.w64s[2] == 0
-          && line->u.w64s[3] == 0 && line->u.w64s[4] == 0) {
-         return 'z';
-      }
-   } else {
-      tl_assert2(0, "unsupported line size (classify_OCacheLine)");
-   }
-   // END fast special-case of the test loop below.
+   // Fast special-case of the test loop below: if no byte has an origin,
+   // the line contains no useful info whatever the w32s are.
+   if (set->d[lineno].w64 == 0)
+      return 'z';
 
    for (i = 0; i < OC_W32S_PER_LINE; i++) {
-      tl_assert(0 == ((~0xF) & line->u.main.descr[i]));
-      if (line->u.main.w32[i] > 0 && line->u.main.descr[i] > 0)
+      tl_assert(0 == ((~0xF) & set->d[lineno].descr[i]));
+      if (set->w32[lineno][i] > 0 && set->d[lineno].descr[i] > 0)
          return 'n'; /* NONZERO - contains useful info */
    }
    return 'z'; /* ZERO - no useful info */
 }
 
-typedef
-   struct {
-      OCacheLine line[OC_LINES_PER_SET];
-   }
-   OCacheSet;
-
-typedef
-   struct {
-      OCacheSet set[OC_N_SETS];
-   }
-   OCache;
-
-static OCache* ocacheL1 = NULL;
-static UWord   ocacheL1_event_ctr = 0;
+static OCacheSet* ocacheL1 = NULL;
+static UWord      ocacheL1_event_ctr = 0;
 
 static void init_ocacheL2 ( void ); /* fwds */
 static void init_OCache ( void )
 {
    UWord line, set;
+   ULong maxszB = (ULong)MC_(clo_origin_cache_size) * 1024 * 1024;
+   SizeT szB;
    tl_assert(MC_(clo_mc_level) >= 3);
    tl_assert(ocacheL1 == NULL);
-   SysRes sres = VG_(am_shadow_alloc)(sizeof(OCache));
+   tl_assert(offsetof(OCacheSet,w32) == 64);
+   ocacheL1_n_sets = 1;
+   while (2 * (ULong)ocacheL1_n_sets * sizeof(OCacheSet) <= maxszB)
+      ocacheL1_n_sets *= 2;
+   ocacheL1_set_mask = ocacheL1_n_sets - 1;
+   szB = ocacheL1_n_sets * sizeof(OCacheSet);
+   SysRes sres = VG_(am_shadow_alloc)(szB);
    if (sr_isError(sres)) {
       VG_(out_of_memory_NORETURN)( "memcheck:allocating ocacheL1",
-                                   sizeof(OCache), sr_Err(sres) );
+                                   szB, sr_Err(sres) );
    }
    ocacheL1 = (void *)(Addr)sr_Res(sres);
    tl_assert(ocacheL1 != NULL);
-   for (set = 0; set < OC_N_SETS; set++) {
+   for (set = 0; set < ocacheL1_n_sets; set++) {
       for (line = 0; line < OC_LINES_PER_SET; line++) {
-         ocacheL1->set[set].line[line].tag = 1/*invalid*/;
+         ocacheL1[set].tag[line] = 1/*invalid*/;
       }
    }
    init_ocacheL2();
@@ -2561,33 +2705,32 @@ static void init_OCache ( void )
 
 static inline void moveLineForwards ( OCacheSet* set, UWord lineno )
 {
-   OCacheLine tmp;
+   UWord        i;
+   Addr         tag;
+   OCacheDescrs d;
+   UInt         w32;
    stats_ocacheL1_movefwds++;
    tl_assert(lineno > 0 && lineno < OC_LINES_PER_SET);
-   tmp = set->line[lineno-1];
-   set->line[lineno-1] = set->line[lineno];
-   set->line[lineno] = tmp;
+   tag = set->tag[lineno-1];
+   set->tag[lineno-1] = set->tag[lineno];
+   set->tag[lineno] = tag;
+   d = set->d[lineno-1];
+   set->d[lineno-1] = set->d[lineno];
+   set->d[lineno] = d;
+   for (i = 0; i < OC_W32S_PER_LINE; i++) {
+      w32 = set->w32[lineno-1][i];
+      set->w32[lineno-1][i] = set->w32[lineno][i];
+      set->w32[lineno][i] = w32;
+   }
 }
 
-static inline void zeroise_OCacheLine ( OCacheLine* line, Addr tag ) {
+static inline void zeroise_OCacheLine ( OCacheSet* set, UWord lineno,
+                                        Addr tag ) {
    UWord i;
-   if (OC_W32S_PER_LINE == 8) {
-      // BEGIN fast special-case of the loop below
-      tl_assert(OC_W64S_PER_MAIN == 5);
-      line->u.w64s[0] = 0;
-      line->u.w64s[1] = 0;
-      line->u.w64s[2] = 0;
-      line->u.w64s[3] = 0;
-      line->u.w64s[4] = 0;
-      // END fast special-case of the loop below
-   } else {
-      tl_assert2(0, "unsupported line size (zeroise_OCacheLine)");
-      for (i = 0; i < OC_W32S_PER_LINE; i++) {
-         line->u.main.w32[i] = 0; /* NO ORIGIN */
-         line->u.main.descr[i] = 0; /* REALLY REALLY NO ORIGIN! */
-      }
-   }
-   line->tag = tag;
+   set->d[lineno].w64 = 0; /* REALLY REALLY NO ORIGIN! */
+   for (i = 0; i < OC_W32S_PER_LINE; i++)
+      set->w32[lineno][i] = 0; /* NO ORIGIN */
+   set->tag[lineno] = tag;
 }
 
 //////////////////////////////////////////////////////////////
@@ -2635,14 +2778,85 @@ static void ocacheL2_free ( void* v ) {
 /* Stats: # nodes currently in tree */
 static UWord stats__ocacheL2_n_nodes = 0;
 
+/* A line as stored in the tree.  Most lines that get ejected from the L1
+   have the same origin for all of their bytes that have an origin, for
+   example because they are part of a single heap block.  Such lines are
+   stored in compressed form, as that origin plus the descrs, which takes
+   a third of the space of a full line.  Other lines also store w32[].
+   Compressed nodes are only allocated with room for the fields up to
+   w32[], and w32[] of nodes that are allocated with room for it is
+   always valid, so that a node can be overwritten in place with a line
+   in the same form. */
+typedef
+   struct {
+      Addr tag;
+      UInt descrs; /* descr[i] is in bits 4*i .. 4*i+3 */
+      UInt otag;   /* if nonzero, the node is compressed and this is the
+                      origin of all bytes that have one */
+      UInt w32[OC_W32S_PER_LINE]; /* only present if otag is zero */
+   }
+   OCacheL2Line;
+
+#define OC_L2_COMPRESSED_SZB (offsetof(OCacheL2Line,w32))
+
+/* If all bytes in 'line' that have an origin have the same one, return
+   it, otherwise return zero. */
+static UInt oc_line_single_otag ( OCacheLine line )
+{
+   UInt otag = 0;
+   Bool seen = False;
+   for (UWord i = 0; i < OC_W32S_PER_LINE; i++) {
+      if (line.descr[i] == 0)
+         continue;
+      if (!seen) {
+         otag = line.w32[i];
+         seen = True;
+      } else if (line.w32[i] != otag) {
+         return 0;
+      }
+   }
+   return otag;
+}
+
+/* Store the line with tag 'tag' in the tree node 'l2', in compressed form
+   if otag is nonzero. */
+static inline void oc_line_to_L2 ( OCacheL2Line* l2, Addr tag,
+                                   OCacheLine line, UInt otag )
+{
+   l2->tag    = tag;
+   l2->descrs = 0;
+   for (UWord i = 0; i < OC_W32S_PER_LINE; i++)
+      l2->descrs |= (UInt)line.descr[i] << (4 * i);
+   l2->otag   = otag;
+   if (otag == 0) {
+      for (UWord i = 0; i < OC_W32S_PER_LINE; i++)
+         l2->w32[i] = line.w32[i];
+   }
+}
+
+/* Load the tree node 'l2' into line 'lineno' of 'set'.  A w32 whose descr
+   is zero is never used, so setting those to zero for compressed lines is
+   harmless. */
+static inline void oc_line_from_L2 ( OCacheSet* set, UWord lineno,
+                                     const OCacheL2Line* l2 )
+{
+   set->tag[lineno] = l2->tag;
+   for (UWord i = 0; i < OC_W32S_PER_LINE; i++) {
+      UChar descr = (l2->descrs >> (4 * i)) & 0xF;
+      set->d[lineno].descr[i] = descr;
+      set->w32[lineno][i]
+         = l2->otag == 0 ? l2->w32[i] : (descr == 0 ? 0 : l2->otag);
+   }
+}
+
 static void init_ocacheL2 ( void )
 {
-   tl_assert(sizeof(Word) == sizeof(Addr)); /* since OCacheLine.tag :: Addr */
-   tl_assert(0 == offsetof(OCacheLine,tag));
+   tl_assert(sizeof(Word) == sizeof(Addr)); /* since OCacheL2Line.tag :: Addr */
+   tl_assert(0 == offsetof(OCacheL2Line,tag));
    for (UInt i = 0; i < 4096; i++) {
       tl_assert(!ocachesL2[i]);
       ocachesL2[i]
-         = VG_(OSetGen_Create)( offsetof(OCacheLine,tag),
+         = VG_(OSetGen_Create)( offsetof(OCacheL2Line,tag),
                                 NULL, /* fast cmp */
                                 ocacheL2_malloc, "mc.ioL2", ocacheL2_free);
    }
@@ -2650,9 +2864,9 @@ static void init_ocacheL2 ( void )
 }
 
 /* Find line with the given tag in the tree, or NULL if not found. */
-static inline OCacheLine* ocacheL2_find_tag ( Addr tag )
+static inline OCacheL2Line* ocacheL2_find_tag ( Addr tag )
 {
-   OCacheLine* line;
+   OCacheL2Line* line;
    tl_assert(is_valid_oc_tag(tag));
    stats__ocacheL2_finds++;
    OSet* oset = ocachesL2[HASH_OCACHE_TAG(tag)];
@@ -2664,7 +2878,7 @@ static inline OCacheLine* ocacheL2_find_tag ( Addr tag )
    free up the associated memory. */
 static void ocacheL2_del_tag ( Addr tag )
 {
-   OCacheLine* line;
+   OCacheL2Line* line;
    tl_assert(is_valid_oc_tag(tag));
    stats__ocacheL2_dels++;
    OSet* oset = ocachesL2[HASH_OCACHE_TAG(tag)];
@@ -2678,54 +2892,69 @@ static void ocacheL2_del_tag ( Addr tag )
 
 /* Add a copy of the given line to the tree.  It must not already be
    present. */
-static void ocacheL2_add_line ( OCacheLine* line )
+static void ocacheL2_add_line ( Addr tag, OCacheLine line, UInt otag )
 {
-   OCacheLine* copy;
-   tl_assert(is_valid_oc_tag(line->tag));
-   OSet* oset = ocachesL2[HASH_OCACHE_TAG(line->tag)];
-   copy = VG_(OSetGen_AllocNode)( oset, sizeof(OCacheLine) );
-   *copy = *line;
+   OCacheL2Line* copy;
+   tl_assert(is_valid_oc_tag(tag));
+   OSet* oset = ocachesL2[HASH_OCACHE_TAG(tag)];
+   copy = VG_(OSetGen_AllocNode)( oset, otag != 0 ? OC_L2_COMPRESSED_SZB
+                                                  : sizeof(OCacheL2Line) );
+   oc_line_to_L2( copy, tag, line, otag );
    stats__ocacheL2_adds++;
+   if (otag != 0)
+      stats__ocacheL2_adds_compr++;
    VG_(OSetGen_Insert)( oset, copy );
    stats__ocacheL2_n_nodes++;
    if (stats__ocacheL2_n_nodes > stats__ocacheL2_n_nodes_max)
       stats__ocacheL2_n_nodes_max = stats__ocacheL2_n_nodes;
 }
 
+/* Copy the given line to the tree, replacing the line with the same tag
+   if there is one. */
+static void ocacheL2_put_line ( Addr tag, OCacheLine line )
+{
+   UInt          otag = oc_line_single_otag(line);
+   OCacheL2Line* inL2 = ocacheL2_find_tag( tag );
+   if (inL2 == NULL) {
+      ocacheL2_add_line( tag, line, otag );
+   } else if (inL2->otag == 0) {
+      /* A full node; keep it full. */
+      oc_line_to_L2( inL2, tag, line, 0 );
+   } else if (otag != 0) {
+      oc_line_to_L2( inL2, tag, line, otag );
+   } else {
+      /* A compressed node, which has no room for w32[]. */
+      ocacheL2_del_tag( tag );
+      ocacheL2_add_line( tag, line, 0 );
+   }
+}
+
 ////
 //////////////////////////////////////////////////////////////
 
 __attribute__((noinline))
-static OCacheLine* find_OCacheLine_SLOW ( Addr a )
+static OCacheLine find_OCacheLine_SLOW ( Addr a )
 {
-   OCacheLine *victim, *inL2;
+   OCacheSet *set;
+   OCacheL2Line *inL2;
    UChar c;
    UWord line;
-   UWord setno   = (a >> OC_BITS_PER_LINE) & (OC_N_SETS - 1);
+   UWord setno   = (a >> OC_BITS_PER_LINE) & ocacheL1_set_mask;
    UWord tagmask = ~((1 << OC_BITS_PER_LINE) - 1);
    UWord tag     = a & tagmask;
-   tl_assert(setno < OC_N_SETS);
-
-   /* we already tried line == 0; skip therefore. */
-   for (line = 1; line < OC_LINES_PER_SET; line++) {
-      if (ocacheL1->set[setno].line[line].tag == tag) {
-         switch (line) {
-         // with OC_LINES_PER_SET equal to 2 this is the only possible case
-         case 1:
-            stats_ocacheL1_found_at_1++;
-            break;
-#if OC_LINES_PER_SET > 2
-         default:
-            stats_ocacheL1_found_at_N++;
-            break;
-#endif
-         }
+   tl_assert(setno < ocacheL1_n_sets);
+   set = &ocacheL1[setno];
+
+   /* we already tried lines 0 and 1; skip therefore. */
+   for (line = 2; line < OC_LINES_PER_SET; line++) {
+      if (set->tag[line] == tag) {
+         stats_ocacheL1_found_at_N++;
          if (UNLIKELY(0 == (ocacheL1_event_ctr++
                             & ((1<<OC_MOVE_FORWARDS_EVERY_BITS)-1)))) {
-            moveLineForwards( &ocacheL1->set[setno], line );
+            moveLineForwards( set, line );
             line--;
          }
-         return &ocacheL1->set[setno].line[line];
+         return oc_set_line( set, line );
       }
    }
 
@@ -2737,8 +2966,7 @@ static OCacheLine* find_OCacheLine_SLOW ( Addr a )
    tl_assert(line > 0);
 
    /* First, move the to-be-ejected line to the L2 cache. */
-   victim = &ocacheL1->set[setno].line[line];
-   c = classify_OCacheLine(victim);
+   c = classify_OCacheLine(set, line);
    switch (c) {
       case 'e':
          /* the line is empty (has invalid tag); ignore it. */
@@ -2749,18 +2977,13 @@ static OCacheLine* find_OCacheLine_SLOW ( Addr a )
             verbatim, or by ensuring it isn't present there.  We
             choose the latter on the basis that it reduces the size of
             the backing store. */
-         ocacheL2_del_tag( victim->tag );
+         ocacheL2_del_tag( set->tag[line] );
          break;
       case 'n':
          /* line contains at least one real, useful origin.  Copy it
             to the backing store. */
          stats_ocacheL1_lossage++;
-         inL2 = ocacheL2_find_tag( victim->tag );
-         if (inL2) {
-            *inL2 = *victim;
-         } else {
-            ocacheL2_add_line( victim );
-         }
+         ocacheL2_put_line( set->tag[line], oc_set_line( set, line ) );
          break;
       default:
          tl_assert(0);
@@ -2768,40 +2991,50 @@ static OCacheLine* find_OCacheLine_SLOW ( Addr a )
 
    /* Now we must reload the L1 cache from the backing tree, if
       possible. */
-   tl_assert(tag != victim->tag); /* stay sane */
+   tl_assert(tag != set->tag[line]); /* stay sane */
    inL2 = ocacheL2_find_tag( tag );
    if (inL2) {
       /* We're in luck.  It's in the L2. */
-      ocacheL1->set[setno].line[line] = *inL2;
+      oc_line_from_L2( set, line, inL2 );
    } else {
       /* Missed at both levels of the cache hierarchy.  We have to
          declare it as full of zeroes (unknown origins). */
       stats__ocacheL2_misses++;
-      zeroise_OCacheLine( &ocacheL1->set[setno].line[line], tag );
+      zeroise_OCacheLine( set, line, tag );
    }
 
-   /* Move it one forwards */
-   moveLineForwards( &ocacheL1->set[setno], line );
-   line--;
+   /* Move it to the front, as it is about to be used, pushing the other
+      lines one back.  Leaving it further back would make the accesses
+      that follow take the slow path until it has been moved forwards. */
+   for (; line > 0; line--)
+      moveLineForwards( set, line );
 
-   return &ocacheL1->set[setno].line[line];
+   return oc_set_line( set, line );
 }
 
-static INLINE OCacheLine* find_OCacheLine ( Addr a )
+static INLINE OCacheLine find_OCacheLine ( Addr a )
 {
-   UWord setno   = (a >> OC_BITS_PER_LINE) & (OC_N_SETS - 1);
+   UWord setno   = (a >> OC_BITS_PER_LINE) & ocacheL1_set_mask;
    UWord tagmask = ~((1 << OC_BITS_PER_LINE) - 1);
    UWord tag     = a & tagmask;
 
    stats_ocacheL1_find++;
 
    if (OC_ENABLE_ASSERTIONS) {
-      tl_assert(setno >= 0 && setno < OC_N_SETS);
+      tl_assert(setno >= 0 && setno < ocacheL1_n_sets);
       tl_assert(0 == (tag & (4 * OC_W32S_PER_LINE - 1)));
    }
 
-   if (LIKELY(ocacheL1->set[setno].line[0].tag == tag)) {
-      return &ocacheL1->set[setno].line[0];
+   OCacheSet* set = &ocacheL1[setno];
+   if (LIKELY(set->tag[0] == tag)) {
+      return oc_set_line( set, 0 );
+   }
+   /* Two lines that map to the same set and are used alternately end up
+      in the first two slots, so check the second one here too.  Its tag
+      is in the same host cache line. */
+   if (LIKELY(set->tag[1] == tag)) {
+      stats_ocacheL1_found_at_1++;
+      return oc_set_line( set, 1 );
    }
 
    return find_OCacheLine_SLOW( a );
@@ -2811,17 +3044,17 @@ static INLINE void set_aligned_word64_Origin_to_undef ( Addr a, UInt otag )
 {
    //// BEGIN inlined, specialised version of MC_(helperc_b_store8)
    //// Set the origins for a+0 .. a+7
-   { OCacheLine* line;
+   { OCacheLine line;
      UWord lineoff = oc_line_offset(a);
      if (OC_ENABLE_ASSERTIONS) {
         tl_assert(lineoff >= 0
                   && lineoff < OC_W32S_PER_LINE -1/*'cos 8-aligned*/);
      }
      line = find_OCacheLine( a );
-     line->u.main.descr[lineoff+0] = 0xF;
-     line->u.main.descr[lineoff+1] = 0xF;
-     line->u.main.w32[lineoff+0]   = otag;
-     line->u.main.w32[lineoff+1]   = otag;
+     line.descr[lineoff+0] = 0xF;
+     line.descr[lineoff+1] = 0xF;
+     line.w32[lineoff+0]   = otag;
+     line.w32[lineoff+1]   = otag;
    }
    //// END inlined, specialised version of MC_(helperc_b_store8)
 }
@@ -2866,14 +3099,14 @@ void make_aligned_word32_undefined_w_otag ( Addr a, UInt otag )
    make_aligned_word32_undefined(a);
    //// BEGIN inlined, specialised version of MC_(helperc_b_store4)
    //// Set the origins for a+0 .. a+3
-   { OCacheLine* line;
+   { OCacheLine line;
      UWord lineoff = oc_line_offset(a);
      if (OC_ENABLE_ASSERTIONS) {
         tl_assert(lineoff >= 0 && lineoff < OC_W32S_PER_LINE);
      }
      line = find_OCacheLine( a );
-     line->u.main.descr[lineoff] = 0xF;
-     line->u.main.w32[lineoff]   = otag;
+     line.descr[lineoff] = 0xF;
+     line.w32[lineoff]   = otag;
    }
    //// END inlined, specialised version of MC_(helperc_b_store4)
 }
@@ -2903,13 +3136,13 @@ void make_aligned_word32_noaccess ( Addr a )
       //// BEGIN inlined, specialised version of MC_(helperc_b_store4)
       //// Set the origins for a+0 .. a+3.
       if (UNLIKELY( MC_(clo_mc_level) == 3 )) {
-         OCacheLine* line;
+         OCacheLine line;
          UWord lineoff = oc_line_offset(a);
          if (OC_ENABLE_ASSERTIONS) {
             tl_assert(lineoff >= 0 && lineoff < OC_W32S_PER_LINE);
          }
          line = find_OCacheLine( a );
-         line->u.main.descr[lineoff] = 0;
+         line.descr[lineoff] = 0;
       }
       //// END inlined, specialised version of MC_(helperc_b_store4)
    }
@@ -2950,14 +3183,14 @@ void make_aligned_word64_undefined_w_otag ( Addr a, UInt otag )
    make_aligned_word64_undefined(a);
    //// BEGIN inlined, specialised version of MC_(helperc_b_store8)
    //// Set the origins for a+0 .. a+7
-   { OCacheLine* line;
+   { OCacheLine line;
      UWord lineoff = oc_line_offset(a);
      tl_assert(lineoff < OC_W32S_PER_LINE -1/*'cos 8-aligned*/);
      line = find_OCacheLine( a );
-     line->u.main.descr[lineoff+0] = 0xF;
-     line->u.main.descr[lineoff+1] = 0xF;
-     line->u.main.w32[lineoff+0]   = otag;
-     line->u.main.w32[lineoff+1]   = otag;
+     line.descr[lineoff+0] = 0xF;
+     line.descr[lineoff+1] = 0xF;
+     line.w32[lineoff+0]   = otag;
+     line.w32[lineoff+1]   = otag;
    }
    //// END inlined, specialised version of MC_(helperc_b_store8)
 }
@@ -2987,12 +3220,12 @@ void make_aligned_word64_noaccess ( Addr a )
       //// BEGIN inlined, specialised version of MC_(helperc_b_store8)
       //// Clear the origins for a+0 .. a+7.
       if (UNLIKELY( MC_(clo_mc_level) == 3 )) {
-         OCacheLine* line;
+         OCacheLine line;
          UWord lineoff = oc_line_offset(a);
          tl_assert(lineoff < OC_W32S_PER_LINE -1/*'cos 8-aligned*/);
          line = find_OCacheLine( a );
-         line->u.main.descr[lineoff+0] = 0;
-         line->u.main.descr[lineoff+1] = 0;
+         line.descr[lineoff+0] = 0;
+         line.descr[lineoff+1] = 0;
       }
       //// END inlined, specialised version of MC_(helperc_b_store8)
    }
@@ -4278,6 +4511,68 @@ static Bool is_mem_addressable ( Addr a, SizeT len,
    return True;
 }
 
+/* The same as is_mem_addressable, but without reporting which byte is
+   not addressable.  Looks at four bytes at a time through their vabits8,
+   or at 4 * sizeof(UWord) bytes at a time through a UWord of them, and
+   skips the parts of the range covered by a distinguished secondary map
+   at once. */
+static Bool is_mem_addressable_fast ( Addr a, SizeT len )
+{
+   /* A vabits8 holds 4 addressable bytes if none of its vabits2 is 00b. */
+#  define ALL_VABITS2_ACCESSIBLE(_w, _lo_bits) \
+      ((((_w) | ((_w) >> 1)) & (_lo_bits)) == (_lo_bits))
+   const UWord lo_bits_word = ((UWord)-1) / 3;   /* 0x5555... */
+
+   while (len > 0 && !VG_IS_4_ALIGNED(a)) {
+      if (VA_BITS2_NOACCESS == get_vabits2(a))
+         return False;
+      a++;
+      len--;
+   }
+
+   while (len >= 4) {
+      SizeT   n   = len & ~(SizeT)3;
+      SecMap* sm  = get_secmap_for_reading(a);
+      UWord   off = SM_OFF(a);
+      UWord   end;
+
+      if (n > SM_SIZE - (a & SM_MASK))
+         n = SM_SIZE - (a & SM_MASK);
+      if (sm == &sm_distinguished[SM_DIST_NOACCESS])
+         return False;
+      if (!is_distinguished_sm(sm)) {
+         end = off + n / 4;
+         while (off < end && !VG_IS_WORD_ALIGNED(off)) {
+            if (!ALL_VABITS2_ACCESSIBLE(sm->vabits8[off], 0x55))
+               return False;
+            off++;
+         }
+         while (off + sizeof(UWord) <= end) {
+            UWord w = *(const UWord*)(Addr)&sm->vabits8[off];
+            if (!ALL_VABITS2_ACCESSIBLE(w, lo_bits_word))
+               return False;
+            off += sizeof(UWord);
+         }
+         while (off < end) {
+            if (!ALL_VABITS2_ACCESSIBLE(sm->vabits8[off], 0x55))
+               return False;
+            off++;
+         }
+      }
+      a   += n;
+      len -= n;
+   }
+
+   while (len > 0) {
+      if (VA_BITS2_NOACCESS == get_vabits2(a))
+         return False;
+      a++;
+      len--;
+   }
+   return True;
+#  undef ALL_VABITS2_ACCESSIBLE
+}
+
 static MC_ReadResult is_mem_defined ( Addr a, SizeT len,
                                       /*OUT*/Addr* bad_addr,
                                       /*OUT*/UInt* otag )
@@ -5899,6 +6194,48 @@ Bool MC_(is_valid_aligned_word) ( Addr a )
 }
 
 
+/* For the memory leak detector: the same as MC_(is_valid_aligned_word)
+   for the MC_VALID_WORDS_GROUP words starting at a, which must be
+   aligned to a multiple of that many words.  Bit i of the result is set
+   if word i is valid.  This does one secondary map lookup for all the
+   words, rather than one or two per word. */
+/* All the words must be in the same secondary map. */
+STATIC_ASSERT(SM_SIZE % (MC_VALID_WORDS_GROUP * sizeof(UWord)) == 0);
+
+UWord MC_(valid_aligned_words_mask) ( Addr a )
+{
+   UWord   mask = 0;
+   UInt    i;
+   SecMap* sm;
+
+   tl_assert(sizeof(UWord) == 4 || sizeof(UWord) == 8);
+   tl_assert(0 == (a & (MC_VALID_WORDS_GROUP * sizeof(UWord) - 1)));
+
+   sm = get_secmap_for_reading(a);
+   if (sm == &sm_distinguished[SM_DIST_DEFINED]) {
+      mask = ~(UWord)0;
+   } else if (!is_distinguished_sm(sm)) {
+      for (i = 0; i < MC_VALID_WORDS_GROUP; i++) {
+         Addr w = a + i * sizeof(UWord);
+         Bool ok = sizeof(UWord) == 8
+                      ? sm->vabits16[SM_OFF_16(w)] == VA_BITS16_DEFINED
+                      : sm->vabits8[SM_OFF(w)] == VA_BITS8_DEFINED;
+         if (ok)
+            mask |= (UWord)1 << i;
+      }
+   }
+
+   if (UNLIKELY(gIgnoredAddressRanges != NULL) && mask != 0) {
+      for (i = 0; i < MC_VALID_WORDS_GROUP; i++) {
+         if ((mask & ((UWord)1 << i))
+             && MC_(in_ignored_range)(a + i * sizeof(UWord)))
+            mask &= ~((UWord)1 << i);
+      }
+   }
+   return mask;
+}
+
+
 /*------------------------------------------------------------*/
 /*--- Initialisation                                       ---*/
 /*------------------------------------------------------------*/
@@ -6066,6 +6403,7 @@ UInt          MC_(clo_leak_check_heuristics)  =   H2S(LchStdString)
                                                 | H2S( LchLength64)
                                                 | H2S( LchNewArray)
                                                 | H2S( LchMultipleInheritance);
+Bool          MC_(clo_incremental_leak_check) = False;
 Bool          MC_(clo_xtree_leak)             = False;
 const HChar*  MC_(clo_xtree_leak_file) = "xtleak.kcg.%p";
 Bool          MC_(clo_workaround_gcc296_bugs) = False;
@@ -6073,6 +6411,7 @@ Int           MC_(clo_malloc_fill)            = -1;
 Int           MC_(clo_free_fill)              = -1;
 KeepStacktraces MC_(clo_keep_stacktraces)     = KS_alloc_and_free;
 Int           MC_(clo_mc_level)               = 2;
+Int           MC_(clo_origin_cache_size)      = 96;
 Bool          MC_(clo_show_mismatched_frees)  = True;
 Bool          MC_(clo_show_realloc_size_zero) = True;
 
@@ -6130,6 +6469,8 @@ static Bool mc_process_cmd_line_options(const HChar* arg)
       }
    }
    else if VG_BOOL_CLO(arg, "--partial-loads-ok", MC_(clo_partial_loads_ok)) {}
+   else if VG_BINT_CLO(arg, "--origin-cache-size",
+                       MC_(clo_origin_cache_size), 1, 4096) {}
    else if VG_USET_CLOM(cloPD, arg, "--errors-for-leak-kinds",
                         MC_(parse_leak_kinds_tokens),
                         MC_(clo_error_for_leak_kinds)) {}
@@ -6139,6 +6480,8 @@ static Bool mc_process_cmd_line_options(const HChar* arg)
    else if VG_USET_CLOM(cloPD, arg, "--leak-check-heuristics",
                         MC_(parse_leak_heuristics_tokens),
                         MC_(clo_leak_check_heuristics)) {}
+   else if VG_BOOL_CLOM(cloPD, arg, "--incremental-leak-check",
+                        MC_(clo_incremental_leak_check)) {}
    else if (VG_BOOL_CLOM(cloPD, arg, "--show-reachable", tmp_show)) {
       if (tmp_show) {
          MC_(clo_show_leak_kinds) = MC_(all_Reachedness)();
@@ -6309,6 +6652,8 @@ static void mc_print_usage(void)
 "        improving leak search false positive [all]\n"
 "        where heur is one of:\n"
 "          stdstring length64 newarray multipleinheritance all none\n"
+"    --incremental-leak-check=no|yes  rescan only the changed parts of the\n"
+"                                     root set at repeated leak searches [no]\n"
 "    --show-reachable=yes             same as --show-leak-kinds=all\n"
 "    --show-reachable=no --show-possibly-lost=yes\n"
 "                                     same as --show-leak-kinds=definite,possible\n"
@@ -6318,6 +6663,7 @@ static void mc_print_usage(void)
 "    --xtree-leak-file=<file>         xtree leak report file [xtleak.kcg.%%p]\n"
 "    --undef-value-errors=no|yes      check for undefined value errors [yes]\n"
 "    --track-origins=no|yes           show origins of undefined values? [no]\n"
+"    --origin-cache-size=<number>     size in MB of the origin cache [96]\n"
 "    --partial-loads-ok=no|yes        too hard to explain here; see manual [yes]\n"
 "    --expensive-definedness-checks=no|auto|yes\n"
 "                                     Use extra-precise definedness tracking [auto]\n"
@@ -6985,6 +7331,48 @@ static Bool handle_gdb_monitor_command (ThreadId tid, HChar *req)
 /*--- Client requests                                      ---*/
 /*------------------------------------------------------------*/
 
+/* Do a large memcpy/memmove (_VG_USERREQ__MEMCHECK_BULK_COPY) or
+   memset (_VG_USERREQ__MEMCHECK_BULK_SET) for the replacement functions
+   in mc_replace_strmem.c, natively rather than on the simulated CPU, and
+   update the shadow memory accordingly.  This is only done when it
+   cannot change the errors reported: the arguments are defined, and the
+   whole of both ranges is addressable and mapped with the needed
+   permissions.  Otherwise returns False and the replacement function
+   does the work itself, reporting the errors as usual.  Origins are not
+   copied, so copies are left to the replacement function when they are
+   tracked. */
+static Bool bulk_copy_or_set ( UWord* arg )
+{
+   Addr  dst = (Addr)arg[1];
+   SizeT len = (SizeT)arg[3];
+
+   if (MC_(clo_mc_level) < 2)
+      return False;
+   if (arg[0] == _VG_USERREQ__MEMCHECK_BULK_COPY && MC_(clo_mc_level) == 3)
+      return False;
+   if (is_mem_defined((Addr)&arg[1], 3 * sizeof(UWord), NULL, NULL) != MC_Ok)
+      return False;
+   if (len == 0 || dst + len < dst)
+      return False;
+   if (!VG_(am_is_valid_for_client)(dst, len, VKI_PROT_WRITE)
+       || !is_mem_addressable_fast(dst, len))
+      return False;
+
+   if (arg[0] == _VG_USERREQ__MEMCHECK_BULK_COPY) {
+      Addr src = (Addr)arg[2];
+      if (src + len < src
+          || !VG_(am_is_valid_for_client)(src, len, VKI_PROT_READ)
+          || !is_mem_addressable_fast(src, len))
+         return False;
+      VG_(memmove)((void*)dst, (void*)src, len);
+      MC_(copy_address_range_state)(src, dst, len);
+   } else {
+      VG_(memset)((void*)dst, (Int)(arg[2] & 0xFF), len);
+      MC_(make_mem_defined)(dst, len);
+   }
+   return True;
+}
+
 static Bool mc_handle_client_request ( ThreadId tid, UWord* arg, UWord* ret )
 {
    Int   i;
@@ -7221,6 +7609,11 @@ static Bool mc_handle_client_request ( ThreadId tid, UWord* arg, UWord* ret )
          return True;
       }
 
+      case _VG_USERREQ__MEMCHECK_BULK_COPY:
+      case _VG_USERREQ__MEMCHECK_BULK_SET:
+         *ret = bulk_copy_or_set(arg) ? 1 : 0;
+         return True;
+
    case _VG_USERREQ__MEMCHECK_VERIFY_ALIGNMENT: {
       struct AlignedAllocInfo *aligned_alloc_info  = (struct AlignedAllocInfo *)arg[1];
       tl_assert(aligned_alloc_info);
@@ -7678,7 +8071,7 @@ static INLINE UInt merge_origins ( UInt or1, UInt or2 ) {
 }
 
 UWord VG_REGPARM(1) MC_(helperc_b_load1)( Addr a ) {
-   OCacheLine* line;
+   OCacheLine line;
    UChar descr;
    UWord lineoff = oc_line_offset(a);
    UWord byteoff = a & 3; /* 0, 1, 2 or 3 */
@@ -7689,7 +8082,7 @@ UWord VG_REGPARM(1) MC_(helperc_b_load1)( Addr a ) {
 
    line = find_OCacheLine( a );
 
-   descr = line->u.main.descr[lineoff];
+   descr = line.descr[lineoff];
    if (OC_ENABLE_ASSERTIONS) {
       tl_assert(descr < 0x10);
    }
@@ -7697,12 +8090,12 @@ UWord VG_REGPARM(1) MC_(helperc_b_load1)( Addr a ) {
    if (LIKELY(0 == (descr & (1 << byteoff))))  {
       return 0;
    } else {
-      return line->u.main.w32[lineoff];
+      return line.w32[lineoff];
    }
 }
 
 UWord VG_REGPARM(1) MC_(helperc_b_load2)( Addr a ) {
-   OCacheLine* line;
+   OCacheLine line;
    UChar descr;
    UWord lineoff, byteoff;
 
@@ -7721,7 +8114,7 @@ UWord VG_REGPARM(1) MC_(helperc_b_load2)( Addr a ) {
    }
    line = find_OCacheLine( a );
 
-   descr = line->u.main.descr[lineoff];
+   descr = line.descr[lineoff];
    if (OC_ENABLE_ASSERTIONS) {
       tl_assert(descr < 0x10);
    }
@@ -7729,12 +8122,12 @@ UWord VG_REGPARM(1) MC_(helperc_b_load2)( Addr a ) {
    if (LIKELY(0 == (descr & (3 << byteoff)))) {
       return 0;
    } else {
-      return line->u.main.w32[lineoff];
+      return line.w32[lineoff];
    }
 }
 
 UWord VG_REGPARM(1) MC_(helperc_b_load4)( Addr a ) {
-   OCacheLine* line;
+   OCacheLine line;
    UChar descr;
    UWord lineoff;
 
@@ -7752,7 +8145,7 @@ UWord VG_REGPARM(1) MC_(helperc_b_load4)( Addr a ) {
 
    line = find_OCacheLine( a );
 
-   descr = line->u.main.descr[lineoff];
+   descr = line.descr[lineoff];
    if (OC_ENABLE_ASSERTIONS) {
       tl_assert(descr < 0x10);
    }
@@ -7760,12 +8153,12 @@ UWord VG_REGPARM(1) MC_(helperc_b_load4)( Addr a ) {
    if (LIKELY(0 == descr)) {
       return 0;
    } else {
-      return line->u.main.w32[lineoff];
+      return line.w32[lineoff];
    }
 }
 
 UWord VG_REGPARM(1) MC_(helperc_b_load8)( Addr a ) {
-   OCacheLine* line;
+   OCacheLine line;
    UChar descrLo, descrHi, descr;
    UWord lineoff;
 
@@ -7783,8 +8176,8 @@ UWord VG_REGPARM(1) MC_(helperc_b_load8)( Addr a ) {
 
    line = find_OCacheLine( a );
 
-   descrLo = line->u.main.descr[lineoff + 0];
-   descrHi = line->u.main.descr[lineoff + 1];
+   descrLo = line.descr[lineoff + 0];
+   descrHi = line.descr[lineoff + 1];
    descr   = descrLo | descrHi;
    if (OC_ENABLE_ASSERTIONS) {
       tl_assert(descr < 0x10);
@@ -7793,8 +8186,8 @@ UWord VG_REGPARM(1) MC_(helperc_b_load8)( Addr a ) {
    if (LIKELY(0 == descr)) {
       return 0; /* both 32-bit chunks are defined */
    } else {
-      UInt oLo = descrLo == 0 ? 0 : line->u.main.w32[lineoff + 0];
-      UInt oHi = descrHi == 0 ? 0 : line->u.main.w32[lineoff + 1];
+      UInt oLo = descrLo == 0 ? 0 : line.w32[lineoff + 0];
+      UInt oHi = descrHi == 0 ? 0 : line.w32[lineoff + 1];
       return merge_origins(oLo, oHi);
    }
 }
@@ -7822,7 +8215,7 @@ UWord VG_REGPARM(1) MC_(helperc_b_load32)( Addr a ) {
 /*--------------------------------------------*/
 
 void VG_REGPARM(2) MC_(helperc_b_store1)( Addr a, UWord d32 ) {
-   OCacheLine* line;
+   OCacheLine line;
    UWord lineoff = oc_line_offset(a);
    UWord byteoff = a & 3; /* 0, 1, 2 or 3 */
 
@@ -7837,30 +8230,30 @@ void VG_REGPARM(2) MC_(helperc_b_store1)( Addr a, UWord d32 ) {
       // The byte is defined.  Just mark it as so in the descr and leave the w32
       // unchanged.  This may make the descr become zero, so the line no longer
       // contains useful info, but that's OK.  No loss of information.
-      line->u.main.descr[lineoff] &= ~(1 << byteoff);
-   } else if (d32 == line->u.main.w32[lineoff]) {
+      line.descr[lineoff] &= ~(1 << byteoff);
+   } else if (d32 == line.w32[lineoff]) {
       // At least one of the four bytes in the w32 is undefined with the same
       // origin.  Just extend the mask.  No loss of information.
-      line->u.main.descr[lineoff] |= (1 << byteoff);
+      line.descr[lineoff] |= (1 << byteoff);
    } else {
       // Here, we have a conflict: at least one byte in the group is undefined
       // but with some other origin.  We can't represent both origins, so we
       // forget about the previous origin and install this one instead.
-      line->u.main.descr[lineoff] = (1 << byteoff);
-      line->u.main.w32[lineoff] = d32;
+      line.descr[lineoff] = (1 << byteoff);
+      line.w32[lineoff] = d32;
    }
 #else
    if (d32 == 0) {
-      line->u.main.descr[lineoff] &= ~(1 << byteoff);
+      line.descr[lineoff] &= ~(1 << byteoff);
    } else {
-      line->u.main.descr[lineoff] |= (1 << byteoff);
-      line->u.main.w32[lineoff] = d32;
+      line.descr[lineoff] |= (1 << byteoff);
+      line.w32[lineoff] = d32;
    }
 #endif
 }
 
 void VG_REGPARM(2) MC_(helperc_b_store2)( Addr a, UWord d32 ) {
-   OCacheLine* line;
+   OCacheLine line;
    UWord lineoff, byteoff;
 
    if (UNLIKELY(a & 1)) {
@@ -7882,26 +8275,26 @@ void VG_REGPARM(2) MC_(helperc_b_store2)( Addr a, UWord d32 ) {
 #if OC_PRECISION_STORE
    // Same logic as in the store1 case above.
    if (LIKELY(d32 == 0)) {
-      line->u.main.descr[lineoff] &= ~(3 << byteoff);
-   } else if (d32 == line->u.main.w32[lineoff]) {
-      line->u.main.descr[lineoff] |= (3 << byteoff);
-      line->u.main.w32[lineoff] = d32;
+      line.descr[lineoff] &= ~(3 << byteoff);
+   } else if (d32 == line.w32[lineoff]) {
+      line.descr[lineoff] |= (3 << byteoff);
+      line.w32[lineoff] = d32;
    } else {
-      line->u.main.descr[lineoff] = (3 << byteoff);
-      line->u.main.w32[lineoff] = d32;
+      line.descr[lineoff] = (3 << byteoff);
+      line.w32[lineoff] = d32;
    }
 #else
    if (d32 == 0) {
-      line->u.main.descr[lineoff] &= ~(3 << byteoff);
+      line.descr[lineoff] &= ~(3 << byteoff);
    } else {
-      line->u.main.descr[lineoff] |= (3 << byteoff);
-      line->u.main.w32[lineoff] = d32;
+      line.descr[lineoff] |= (3 << byteoff);
+      line.w32[lineoff] = d32;
    }
 #endif
 }
 
 void VG_REGPARM(2) MC_(helperc_b_store4)( Addr a, UWord d32 ) {
-   OCacheLine* line;
+   OCacheLine line;
    UWord lineoff;
 
    if (UNLIKELY(a & 3)) {
@@ -7919,16 +8312,16 @@ void VG_REGPARM(2) MC_(helperc_b_store4)( Addr a, UWord d32 ) {
    line = find_OCacheLine( a );
 
    if (d32 == 0) {
-      line->u.main.descr[lineoff] = 0;
+      line.descr[lineoff] = 0;
    } else {
-      line->u.main.descr[lineoff] = 0xF;
-      line->u.main.w32[lineoff] = d32;
+      line.descr[lineoff] = 0xF;
+      line.w32[lineoff] = d32;
    }
 }
 
 void VG_REGPARM(2) MC_(helperc_b_store8)( Addr a, UWord d32 ) {
    STATIC_ASSERT(OC_W32S_PER_LINE == 8);
-   OCacheLine* line;
+   OCacheLine line;
    UWord lineoff;
 
    if (UNLIKELY(a & 7)) {
@@ -7946,19 +8339,19 @@ void VG_REGPARM(2) MC_(helperc_b_store8)( Addr a, UWord d32 ) {
    line = find_OCacheLine( a );
 
    if (d32 == 0) {
-      line->u.main.descr[lineoff + 0] = 0;
-      line->u.main.descr[lineoff + 1] = 0;
+      line.descr[lineoff + 0] = 0;
+      line.descr[lineoff + 1] = 0;
    } else {
-      line->u.main.descr[lineoff + 0] = 0xF;
-      line->u.main.descr[lineoff + 1] = 0xF;
-      line->u.main.w32[lineoff + 0] = d32;
-      line->u.main.w32[lineoff + 1] = d32;
+      line.descr[lineoff + 0] = 0xF;
+      line.descr[lineoff + 1] = 0xF;
+      line.w32[lineoff + 0] = d32;
+      line.w32[lineoff + 1] = d32;
    }
 }
 
 void VG_REGPARM(2) MC_(helperc_b_store16)( Addr a, UWord d32 ) {
    STATIC_ASSERT(OC_W32S_PER_LINE == 8);
-   OCacheLine* line;
+   OCacheLine line;
    UWord lineoff;
 
    if (UNLIKELY(a & 15)) {
@@ -7976,25 +8369,25 @@ void VG_REGPARM(2) MC_(helperc_b_store16)( Addr a, UWord d32 ) {
    line = find_OCacheLine( a );
 
    if (d32 == 0) {
-      line->u.main.descr[lineoff + 0] = 0;
-      line->u.main.descr[lineoff + 1] = 0;
-      line->u.main.descr[lineoff + 2] = 0;
-      line->u.main.descr[lineoff + 3] = 0;
+      line.descr[lineoff + 0] = 0;
+      line.descr[lineoff + 1] = 0;
+      line.descr[lineoff + 2] = 0;
+      line.descr[lineoff + 3] = 0;
    } else {
-      line->u.main.descr[lineoff + 0] = 0xF;
-      line->u.main.descr[lineoff + 1] = 0xF;
-      line->u.main.descr[lineoff + 2] = 0xF;
-      line->u.main.descr[lineoff + 3] = 0xF;
-      line->u.main.w32[lineoff + 0] = d32;
-      line->u.main.w32[lineoff + 1] = d32;
-      line->u.main.w32[lineoff + 2] = d32;
-      line->u.main.w32[lineoff + 3] = d32;
+      line.descr[lineoff + 0] = 0xF;
+      line.descr[lineoff + 1] = 0xF;
+      line.descr[lineoff + 2] = 0xF;
+      line.descr[lineoff + 3] = 0xF;
+      line.w32[lineoff + 0] = d32;
+      line.w32[lineoff + 1] = d32;
+      line.w32[lineoff + 2] = d32;
+      line.w32[lineoff + 3] = d32;
    }
 }
 
 void VG_REGPARM(2) MC_(helperc_b_store32)( Addr a, UWord d32 ) {
    STATIC_ASSERT(OC_W32S_PER_LINE == 8);
-   OCacheLine* line;
+   OCacheLine line;
    UWord lineoff;
 
    if (UNLIKELY(a & 31)) {
@@ -8012,31 +8405,31 @@ void VG_REGPARM(2) MC_(helperc_b_store32)( Addr a, UWord d32 ) {
    line = find_OCacheLine( a );
 
    if (d32 == 0) {
-      line->u.main.descr[0] = 0;
-      line->u.main.descr[1] = 0;
-      line->u.main.descr[2] = 0;
-      line->u.main.descr[3] = 0;
-      line->u.main.descr[4] = 0;
-      line->u.main.descr[5] = 0;
-      line->u.main.descr[6] = 0;
-      line->u.main.descr[7] = 0;
+      line.descr[0] = 0;
+      line.descr[1] = 0;
+      line.descr[2] = 0;
+      line.descr[3] = 0;
+      line.descr[4] = 0;
+      line.descr[5] = 0;
+      line.descr[6] = 0;
+      line.descr[7] = 0;
    } else {
-      line->u.main.descr[0] = 0xF;
-      line->u.main.descr[1] = 0xF;
-      line->u.main.descr[2] = 0xF;
-      line->u.main.descr[3] = 0xF;
-      line->u.main.descr[4] = 0xF;
-      line->u.main.descr[5] = 0xF;
-      line->u.main.descr[6] = 0xF;
-      line->u.main.descr[7] = 0xF;
-      line->u.main.w32[0] = d32;
-      line->u.main.w32[1] = d32;
-      line->u.main.w32[2] = d32;
-      line->u.main.w32[3] = d32;
-      line->u.main.w32[4] = d32;
-      line->u.main.w32[5] = d32;
-      line->u.main.w32[6] = d32;
-      line->u.main.w32[7] = d32;
+      line.descr[0] = 0xF;
+      line.descr[1] = 0xF;
+      line.descr[2] = 0xF;
+      line.descr[3] = 0xF;
+      line.descr[4] = 0xF;
+      line.descr[5] = 0xF;
+      line.descr[6] = 0xF;
+      line.descr[7] = 0xF;
+      line.w32[0] = d32;
+      line.w32[1] = d32;
+      line.w32[2] = d32;
+      line.w32[3] = d32;
+      line.w32[4] = d32;
+      line.w32[5] = d32;
+      line.w32[6] = d32;
+      line.w32[7] = d32;
    }
 }
 
@@ -8411,6 +8804,16 @@ static void mc_print_stats (void)
                    stats_ocacheL1_find,
                    stats_ocacheL1_misses,
                    stats_ocacheL1_lossage );
+      VG_(message)(Vg_DebugMsg,
+                   " ocacheL1: %13.3f%% hits  %13.3f%% at 0\n",
+                   stats_ocacheL1_find == 0 ? 0.0
+                   : 100.0 * (stats_ocacheL1_find - stats_ocacheL1_misses)
+                     / stats_ocacheL1_find,
+                   stats_ocacheL1_find == 0 ? 0.0
+                   : 100.0 * (stats_ocacheL1_find - stats_ocacheL1_misses
+                              - stats_ocacheL1_found_at_1
+                              - stats_ocacheL1_found_at_N)
+                     / stats_ocacheL1_find );
       VG_(message)(Vg_DebugMsg,
                    " ocacheL1: %'14lu at 0   %'14lu at 1\n",
                    stats_ocacheL1_find - stats_ocacheL1_misses
@@ -8422,13 +8825,19 @@ static void mc_print_stats (void)
                    stats_ocacheL1_found_at_N,
                    stats_ocacheL1_movefwds );
       VG_(message)(Vg_DebugMsg,
-                   " ocacheL1: %'14lu sizeB  %'14d useful\n",
-                   (SizeT)sizeof(OCache),
-                   4 * OC_W32S_PER_LINE * OC_LINES_PER_SET * OC_N_SETS );
+                   " ocacheL1: %'14lu sizeB  %'14lu useful\n",
+                   ocacheL1_n_sets * sizeof(OCacheSet),
+                   4 * OC_W32S_PER_LINE * OC_LINES_PER_SET * ocacheL1_n_sets );
       VG_(message)(Vg_DebugMsg,
                    " ocacheL2: %'14lu finds  %'14lu misses\n",
                    stats__ocacheL2_finds,
                    stats__ocacheL2_misses );
+      VG_(message)(Vg_DebugMsg,
+                   " ocacheL2: %13.3f%% hits  %'14lu compressed adds\n",
+                   stats_ocacheL1_misses == 0 ? 0.0
+                   : 100.0 * (stats_ocacheL1_misses - stats__ocacheL2_misses)
+                     / stats_ocacheL1_misses,
+                   stats__ocacheL2_adds_compr );
       VG_(message)(Vg_DebugMsg,
                    " ocacheL2: %'14lu adds   %'14lu dels\n",
                    stats__ocacheL2_adds,
@@ -30,6 +30,9 @@
 #ifdef AVX_512
 #include "mc_include_AVX512.h"
 
+/* These represent 256 bits of memory. */
+#define VA_BITS64_DEFINED     0xaaaaaaaaaaaaaaaaULL  // 10_10_10_10b x 8
+
 /*------------------------------------------------------------*/
 /*--- Functions called directly from generated code:       ---*/
 /*--- Load/store handlers.                                 ---*/
@@ -159,6 +162,7 @@ INLINE void mc_LOADV_512 ( /*OUT*/ULong* res, Addr a, SizeT nBits )
       UWord   nBytes  = nBits / 8;
       UWord   nULongs = nBytes / 8;
       SecMap* sm = NULL;
+      ULong*  vabits64 = NULL;
 
       if (UNLIKELY( UNALIGNED_OR_HIGH(a,nBits) )) {
          PROF_EVENT(MCPE_LOADV_512_SLOW1);
@@ -166,12 +170,23 @@ INLINE void mc_LOADV_512 ( /*OUT*/ULong* res, Addr a, SizeT nBits )
          return;
       }
 
-      /* Handle common cases quickly: a (and a+8 and a+16 etc.) is
-         suitably aligned, is mapped, and addressible. */
+      /* a is 64-aligned, hence a .. a+63 are in the same SecMap, and
+         their VA bits are in 8 consecutive UShorts of it, which can be
+         looked at as 2 ULongs. */
+      sm       = get_secmap_for_reading_low(a);
+      sm_off16 = SM_OFF_16(a);
+      vabits64 = (ULong*)&sm->vabits16[sm_off16];
+
+      /* Handle the most common case, all of it defined, quickly. */
+      if (LIKELY(vabits64[0] == VA_BITS64_DEFINED
+                 && vabits64[1] == VA_BITS64_DEFINED)) {
+         for (j = 0; j < nULongs; j++)
+            res[j] = V_BITS64_DEFINED;
+         return;
+      }
+
       for (j = 0; j < nULongs; j++) {
-         sm       = get_secmap_for_reading_low(a + 8*j);
-         sm_off16 = SM_OFF_16(a + 8*j);
-         vabits16 = sm->vabits16[sm_off16];
+         vabits16 = sm->vabits16[sm_off16 + j];
 
          // Convert V bits from compact memory form to expanded
          // register form.
@@ -196,12 +211,56 @@ VG_REGPARM(2) void MC_(helperc_LOADV512) ( /*OUT*/V512* res, Addr a ) {
    mc_LOADV_512(&res->w64[0], a, 512);
 }
 
+/* Mark the 64 bytes at a as defined.  Generated code calls this rather
+   than MC_(helperc_STOREV64le) for each 8 bytes when all V bits of a
+   512 bit store are defined.  Anything other than an aligned store to
+   memory that is already addressable is handed to mc_STOREV64 8 bytes at
+   a time, so the errors reported are the same either way. */
+VG_REGPARM(1) void MC_(helperc_STOREV512le_defined) ( Addr a )
+{
+   UWord j;
+
+   PROF_EVENT(MCPE_STOREV512_DEFINED);
+
+#ifdef PERF_FAST_STOREV
+   if (LIKELY( !UNALIGNED_OR_HIGH(a,512) )) {
+      SecMap* sm       = get_secmap_for_reading_low(a);
+      UWord   sm_off16 = SM_OFF_16(a);
+      ULong*  vabits64 = (ULong*)&sm->vabits16[sm_off16];
+
+      if (LIKELY(vabits64[0] == VA_BITS64_DEFINED
+                 && vabits64[1] == VA_BITS64_DEFINED)) {
+         return;
+      }
+      if (!is_distinguished_sm(sm)) {
+         for (j = 0; j < 8; j++) {
+            UWord vabits16 = sm->vabits16[sm_off16 + j];
+            if (vabits16 != VA_BITS16_DEFINED
+                && vabits16 != VA_BITS16_UNDEFINED)
+               break;
+         }
+         if (j == 8) {
+            vabits64[0] = VA_BITS64_DEFINED;
+            vabits64[1] = VA_BITS64_DEFINED;
+            return;
+         }
+      }
+      PROF_EVENT(MCPE_STOREV512_DEFINED_SLOW);
+   }
+#endif
+
+   for (j = 0; j < 8; j++)
+      mc_STOREV64( a + 8*j, V_BITS64_DEFINED, False );
+}
+
 void init_prof_mem_evex(void) {
 #ifdef MC_PROFILE_MEMORY
    MC_(event_ctr_name)[MCPE_LOADV_512_SLOW_LOOP] = "LOADV_512_slow(loop)";
    MC_(event_ctr_name)[MCPE_LOADV_512]           = "LOADV_512";
    MC_(event_ctr_name)[MCPE_LOADV_512_SLOW1]     = "LOADV_512-slow1";
    MC_(event_ctr_name)[MCPE_LOADV_512_SLOW2]     = "LOADV_512-slow2";
+   MC_(event_ctr_name)[MCPE_STOREV512_DEFINED]      = "STOREV512_defined";
+   MC_(event_ctr_name)[MCPE_STOREV512_DEFINED_SLOW] = "STOREV512_defined-slow";
 #endif
 }
 
@@ -43,4 +43,21 @@
                   _VG_USERREQ__MEMCHECK_RECORD_OVERLAP_ERROR,   \
                   s, src, dst, len, 0)
 
+// Copies and sets of at least this many bytes are first offered to the
+// tool, which does them natively when that does not change the errors
+// reported.  Below this, a client request costs more than it saves.
+#define MC_BULK_MIN_LEN 256
+
+#define BULK_COPY(dst, src, len)                                \
+   ((len) >= MC_BULK_MIN_LEN                                    \
+    && VALGRIND_DO_CLIENT_REQUEST_EXPR(0,                       \
+                  _VG_USERREQ__MEMCHECK_BULK_COPY,              \
+                  dst, src, len, 0, 0))
+
+#define BULK_SET(dst, c, len)                                   \
+   ((len) >= MC_BULK_MIN_LEN                                    \
+    && VALGRIND_DO_CLIENT_REQUEST_EXPR(0,                       \
+                  _VG_USERREQ__MEMCHECK_BULK_SET,               \
+                  dst, c, len, 0, 0))
+
 #include "../shared/vg_replace_strmem.c"
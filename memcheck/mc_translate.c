@@ -7386,6 +7386,11 @@ static void gen_store_b ( MCEnv* mce, Int szB,
       case 32: hFun  = (void*)&MC_(helperc_b_store32);
                hName = "MC_(helperc_b_store32)";
                break;
+#ifdef AVX_512
+      case 64: hFun  = (void*)&MC_(helperc_b_store64);
+               hName = "MC_(helperc_b_store64)";
+               break;
+#endif
       default:
          tl_assert(0);
    }
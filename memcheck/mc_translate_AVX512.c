@@ -495,13 +495,42 @@ void do_shadow_Store_512 ( MCEnv* mce,
                        IRAtom* guard )
 {
    tl_assert(end == Iend_LE);
-   if (MC_(clo_mc_level) == 1) {
-      vdata = IRExpr_Const( IRConst_V512(V_BITS32_DEFINED) );
-   }
    complainIfUndefined( mce, addr, guard );
 
    IRType tyAddr = mce->hWordTy;
    IROp mkAdd = (tyAddr==Ity_I32) ? Iop_Add32 : Iop_Add64;
+   IRAtom* eBias = tyAddr==Ity_I32 ? mkU32(bias) : mkU64(bias);
+   IRAtom* eAddr = assignNew('V', mce, tyAddr, binop(mkAdd, addr, eBias) );
+
+   /* Most stored values are entirely defined.  For those, a single call
+      to MC_(helperc_STOREV512le_defined) does the job, rather than one
+      call to MC_(helperc_STOREV64le) per 64 bits. */
+   IRDirty* diD = unsafeIRDirty_0_N(
+         1/*regparms*/,
+         "MC_(helperc_STOREV512le_defined)",
+         VG_(fnptr_to_fnentry)( &MC_(helperc_STOREV512le_defined) ),
+         mkIRExprVec_1( eAddr )
+         );
+   if (MC_(clo_mc_level) == 1) {
+      /* Not doing undefined value checking; pretend that the value is
+         all valid. */
+      if (guard)
+         diD->guard = guard;
+      setHelperAnns( mce, diD );
+      stmt( 'V', mce, IRStmt_Dirty(diD) );
+      return;
+   }
+
+   IRAtom* undef = CollapseTo1( mce, vdata );
+   IRAtom* defined = assignNew('V', mce, Ity_I1, unop(Iop_Not1, undef));
+   if (guard) {
+      undef = assignNew('V', mce, Ity_I1, binop(Iop_And1, guard, undef));
+      defined = assignNew('V', mce, Ity_I1, binop(Iop_And1, guard, defined));
+   }
+   diD->guard = defined;
+   setHelperAnns( mce, diD );
+   stmt( 'V', mce, IRStmt_Dirty(diD) );
+
    void* helper = &MC_(helperc_STOREV64le);
    const HChar* hname = "MC_(helperc_STOREV64le)";
 
@@ -516,8 +545,7 @@ void do_shadow_Store_512 ( MCEnv* mce,
             hname, VG_(fnptr_to_fnentry)( helper ),
             mkIRExprVec_2( addrQ[i], vdataQ[i] )
             );
-      if (guard)
-         diQ[i]->guard = guard;
+      diQ[i]->guard = undef;
       setHelperAnns( mce, diQ[i] );
       stmt( 'V', mce, IRStmt_Dirty(diQ[i]) );
    }
@@ -0,0 +1,19 @@
+// Set up the 512-bit shadow memory test, by defining the
+// required vector-copy function, and then including the
+// template.
+
+#define VECTOR_BYTES 64
+
+static __attribute__((noinline))
+void vector_copy ( void* dst, void* src )
+{
+  /* Not all GCC versions allow "zmm7" in the clobber list.
+     Simulate it with "xmm7". */
+  __asm__ __volatile__(
+     "vmovupd (%1), %%zmm7 ; vmovupd %%zmm7, (%0)"
+     : /*OUT*/ : /*IN*/ "r"(dst), "r"(src) : "memory","xmm7"
+  );
+}
+
+// Include the test body, which refers to the above function
+#include "../common/sh-mem-vec128.tmpl.c"
@@ -0,0 +1,61 @@
+/* Big memcpy, memmove and memset calls can be done natively by
+   Memcheck.  Check that the definedness of the copied bytes is the same
+   as with the replacement functions doing the copy, and that the errors
+   reported are unchanged. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N 8192
+
+int main(void)
+{
+   char *a = malloc(N);
+   char *b = malloc(N);
+   char *c = malloc(N);
+   int  *undef = malloc(sizeof(int));
+
+   /* The second half of a is undefined. */
+   memset(a, 1, N / 2);
+   memcpy(b, a, N);
+   if (b[0] == 1)
+      fprintf(stderr, "b[0] is defined\n");
+   if (b[N - 1])                         /* uninitialised */
+      fprintf(stderr, "b[N-1]\n");
+
+   /* Overlapping moves, both ways. */
+   memmove(b + 16, b, N - 16);
+   if (b[N / 2 + 8] == 1)
+      fprintf(stderr, "b[N/2+8] is defined\n");
+   if (b[N / 2 + 16])                    /* uninitialised */
+      fprintf(stderr, "b[N/2+16]\n");
+   memmove(b, b + 24, N - 24);
+   if (b[N / 2 - 16] == 1)
+      fprintf(stderr, "b[N/2-16] is defined\n");
+   if (b[N / 2 - 8])                     /* uninitialised */
+      fprintf(stderr, "b[N/2-8]\n");
+
+   /* Partially defined bytes. */
+   memset(c, 0, N);
+   a[5] = *undef & 0xf0;
+   memcpy(c + 4, a + 4, 1024);
+   if (c[5] & 0x0f)
+      fprintf(stderr, "c[5] low bits\n");
+   if (c[5] & 0xf0)                      /* uninitialised */
+      fprintf(stderr, "c[5] high bits\n");
+
+   /* Setting with an undefined value. */
+   memset(c, *undef, N);
+   if (c[N - 1])                         /* uninitialised */
+      fprintf(stderr, "c[N-1]\n");
+
+   /* Writing one byte past the end of b. */
+   memmove(b + 1, a, N);
+
+   free(a);
+   free(b);
+   free(c);
+   free(undef);
+   return 0;
+}
@@ -0,0 +1,58 @@
+/* Check that origins survive being evicted from the first level origin
+   cache, which is made as small as possible by the .vgtest.  'single' is
+   a block whose origin lines all have the same origin, which are stored
+   compressed when evicted; 'mixed' holds bytes from two different blocks
+   in each of its lines, which are stored in full. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define N_BYTES 256
+#define SWEEP_BYTES (16 * 1024 * 1024)
+
+static void sweep(void)
+{
+   /* Touch enough memory to evict every line of the origin cache. */
+   char* p = malloc(SWEEP_BYTES);
+   int i;
+   for (i = 0; i < SWEEP_BYTES; i += 16)
+      p[i] = 0;
+   free(p);
+}
+
+static int test(const char* p, int n)
+{
+   int i, r = 0;
+   for (i = 0; i < n; i += 16)
+      if (p[i] == 0x42)
+         r++;
+   return r;
+}
+
+int main(void)
+{
+   char* single = malloc(N_BYTES);
+   char* a = malloc(N_BYTES);
+   char* b = malloc(N_BYTES);
+   char* mixed = malloc(N_BYTES);
+   int i, r = 0;
+
+   /* Interleave undefined bytes from a and b, 8 bytes at a time. */
+   for (i = 0; i < N_BYTES; i += 16) {
+      memcpy(mixed + i, a + i, 8);
+      memcpy(mixed + i + 8, b + i + 8, 8);
+   }
+
+   sweep();
+
+   r += test(single, N_BYTES);
+   r += test(mixed, N_BYTES);
+   r += test(mixed + 8, N_BYTES - 8);
+
+   free(single);
+   free(a);
+   free(b);
+   free(mixed);
+
+   return r & 1;
+}
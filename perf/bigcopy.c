@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// bigcopy is an artificial benchmark for the memcpy, memmove and memset
+// replacements of tools like memcheck.  It repeatedly sets, copies and
+// moves (with overlap) big buffers, part of which holds undefined bytes
+// so that the tool has to copy non-trivial shadow state along.
+//
+// Usage: bigcopy [nr_loops [buffer_size_in_KB]]
+
+static int nr_loops = 50;
+static size_t buf_szB = 4 * 1024 * 1024;
+
+int main(int argc, char *argv[])
+{
+   unsigned char *a, *b;
+   unsigned long sum = 0;
+   int loop;
+   size_t i;
+
+   if (argc > 1)
+      nr_loops = atoi(argv[1]);
+   if (argc > 2)
+      buf_szB = (size_t)atoi(argv[2]) * 1024;
+   if (nr_loops < 1 || buf_szB < 4096) {
+      fprintf(stderr, "usage: bigcopy [nr_loops [buffer_KB]]\n");
+      return 1;
+   }
+
+   a = malloc(buf_szB);
+   b = malloc(buf_szB);
+   if (a == NULL || b == NULL) {
+      perror("malloc");
+      return 1;
+   }
+   // The second half of a is left undefined.
+   memset(a, 1, buf_szB / 2);
+
+   for (loop = 0; loop < nr_loops; loop++) {
+      memcpy(b, a, buf_szB);
+      memmove(b + 16, b, buf_szB - 16);
+      memmove(a, a + 8, buf_szB / 2 - 8);
+      memset(b, loop & 0xff, buf_szB / 4);
+      for (i = 0; i < buf_szB / 4; i += 4096)
+         sum += b[i] + a[i];
+   }
+
+   printf("%d\n", sum != 0);
+   free(a);
+   free(b);
+   return 0;
+}
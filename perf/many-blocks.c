@@ -0,0 +1,78 @@
+// Performance test for the leak checker with a big heap.
+// Allocates many small blocks, which point at each other (at their
+// start or inside them) and which also contain words that do not point
+// at any block, and keeps some of them reachable from a big root table
+// that also contains non-pointers.  Nearly all the leak check time is
+// spent scanning memory and looking up the blocks the scanned words
+// point into, so the run time with --leak-check=full is dominated by
+// the scan throughput of the leak checker.
+//
+// Usage: many-blocks [nr_blocks [nr_root_words]]
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#define WORDS_PER_BLOCK 6
+
+static unsigned long seed = 42;
+
+static unsigned long next_random(void)
+{
+   seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+   return seed >> 17;
+}
+
+int main(int argc, char *argv[])
+{
+   long nr_blocks = 1000000;
+   long nr_root_words = 1000000;
+   void ***blocks;
+   void **roots;
+   long i, j, nr_leaked = 0;
+
+   if (argc > 1)
+      nr_blocks = atol(argv[1]);
+   if (argc > 2)
+      nr_root_words = atol(argv[2]);
+   if (nr_blocks < 1 || nr_root_words < 1) {
+      fprintf(stderr, "usage: many-blocks [nr_blocks [nr_root_words]]\n");
+      return 1;
+   }
+
+   blocks = malloc(nr_blocks * sizeof(void **));
+   for (i = 0; i < nr_blocks; i++)
+      blocks[i] = malloc(WORDS_PER_BLOCK * sizeof(void *)
+                         + next_random() % 32);
+
+   for (i = 0; i < nr_blocks; i++) {
+      for (j = 0; j < WORDS_PER_BLOCK; j++) {
+         unsigned long r = next_random();
+         if (j < 2) {
+            // Pointers to the start of, or inside, another block.
+            char *target = (char *)blocks[r % nr_blocks];
+            blocks[i][j] = target + (r & 1 ? sizeof(void *) : 0);
+         } else {
+            // Data: small integers and random values.
+            blocks[i][j] = (void *)(j == 2 ? r % 1000 : r);
+         }
+      }
+   }
+
+   roots = malloc(nr_root_words * sizeof(void *));
+   for (i = 0; i < nr_root_words; i++) {
+      unsigned long r = next_random();
+      roots[i] = i % 16 == 0 ? (void *)blocks[r % nr_blocks] : (void *)r;
+   }
+
+   // Forget about the blocks not referenced from roots.
+   for (i = 0; i < nr_blocks; i++) {
+      if (i % 4 != 0) {
+         blocks[i] = NULL;
+         nr_leaked++;
+      }
+   }
+
+   printf("blocks: %ld, unreferenced: %ld, root words: %ld\n",
+          nr_blocks, nr_leaked, nr_root_words);
+   return 0;
+}
@@ -0,0 +1,71 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// shadowmem is an artificial benchmark that hammers the shadow memory
+// of tools like memcheck from several threads at once.  Each thread
+// repeatedly allocates a big block, writes all of it with aligned
+// word stores, reads it back, and frees it.  For memcheck this means
+// lots of secondary maps being created (the block becomes undefined,
+// then defined) and discarded again (the block becomes noaccess when
+// freed), as well as a steady stream of aligned V bit loads and stores.
+//
+// Usage: shadowmem [nr_threads [nr_loops [block_size_in_KB]]]
+
+static int nr_thr  = 4;
+static int nr_loops = 20;
+static size_t block_szB = 4 * 1024 * 1024;
+
+static void *shadowmem_fn(void *v)
+{
+   long me = (long)v;
+   unsigned long sum = 0;
+   int loop;
+   size_t i, nr_words = block_szB / sizeof(unsigned long);
+
+   for (loop = 0; loop < nr_loops; loop++) {
+      unsigned long *b = malloc(block_szB);
+      if (b == NULL) {
+         perror("malloc");
+         exit(1);
+      }
+      for (i = 0; i < nr_words; i++)
+         b[i] = i + me + loop;
+      for (i = 0; i < nr_words; i += 3)
+         sum += b[i];
+      free(b);
+   }
+   return (void *)sum;
+}
+
+int main(int argc, char *argv[])
+{
+   pthread_t *thr;
+   unsigned long total = 0;
+   long t;
+
+   if (argc > 1)
+      nr_thr = atoi(argv[1]);
+   if (argc > 2)
+      nr_loops = atoi(argv[2]);
+   if (argc > 3)
+      block_szB = (size_t)atoi(argv[3]) * 1024;
+   if (nr_thr < 1 || nr_loops < 1 || block_szB < sizeof(unsigned long)) {
+      fprintf(stderr, "usage: shadowmem [nr_threads [nr_loops [block_KB]]]\n");
+      return 1;
+   }
+
+   thr = malloc(nr_thr * sizeof(pthread_t));
+   for (t = 0; t < nr_thr; t++)
+      pthread_create(&thr[t], NULL, shadowmem_fn, (void *)t);
+   for (t = 0; t < nr_thr; t++) {
+      void *res;
+      pthread_join(thr[t], &res);
+      total += (unsigned long)res;
+   }
+   free(thr);
+
+   printf("%d\n", total != 0);
+   return 0;
+}
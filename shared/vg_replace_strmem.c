@@ -188,6 +188,15 @@ static inline void my_exit ( int x )
 #define FOR_COPY(x) x
 #endif
 
+// Used for tools that can do a big memcpy, memmove or memset natively,
+// shadow state included.  Evaluates to nonzero if the tool did it.
+#ifndef BULK_COPY
+#define BULK_COPY(dst, src, len) 0
+#endif
+#ifndef BULK_SET
+#define BULK_SET(dst, c, len) 0
+#endif
+
 #ifndef VALGRIND_CHECK_VALUE_IS_DEFINED
 #define VALGRIND_CHECK_VALUE_IS_DEFINED(__lvalue) 1
 #endif
@@ -1055,6 +1064,9 @@ static inline void my_exit ( int x )
       if (do_ol_check && is_overlap(dst, src, len, len)) \
          RECORD_OVERLAP_ERROR("memcpy", dst, src, len); \
       \
+      if (BULK_COPY(dst, src, len)) \
+         return dst; \
+      \
       const Addr WS = sizeof(UWord); /* 8 or 4 */ \
       const Addr WM = WS - 1;        /* 7 or 3 */ \
       \
@@ -1348,6 +1360,8 @@ static inline void my_exit ( int x )
    void* VG_REPLACE_FUNCTION_EZZ(20210,soname,fnname) \
             (void *s, Int c, SizeT n) \
    { \
+      if (BULK_SET(s, c, n)) \
+         return s; \
       if (sizeof(void*) == 8) { \
          Addr  a  = (Addr)s;   \
          ULong c8 = (c & 0xFF); \
@@ -1451,6 +1465,8 @@ static inline void my_exit ( int x )
             (const void *srcV, void *dstV, SizeT n) \
    { \
       RECORD_COPY(n); \
+      if (BULK_COPY(dstV, srcV, n)) \
+         return; \
       SizeT i; \
       HChar* dst = dstV; \
       const HChar* src = srcV; \
@@ -1499,6 +1515,8 @@ static inline void my_exit ( int x )
       const HChar* src = srcV; \
       if (destlen < n) \
          goto badness; \
+      if (BULK_COPY(dstV, srcV, n)) \
+         return dst; \
       if (dst < src) { \
          for (i = 0; i < n; i++) \
             dst[i] = src[i]; \
@@ -1738,6 +1756,8 @@ static inline void my_exit ( int x )
          return dst; \
       if (CHECK_OVERLAP && is_overlap(dst, src, len, len)) \
          RECORD_OVERLAP_ERROR("memcpy_chk", dst, src, len); \
+      if (BULK_COPY(dst, src, len)) \
+         return dst; \
       if ( dst > src ) { \
          d = (HChar *)dst + len - 1; \
          s = (const HChar *)src + len - 1; \